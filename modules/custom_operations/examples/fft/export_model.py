@@ -7,6 +7,7 @@ import torch
 import torch.nn as nn
 from torch.autograd import Variable
 from .fft import FFT
+from ..complex_mul.complex_mul import ComplexMul
 
 
 class MyModel(nn.Module):
@@ -21,6 +22,21 @@ class MyModel(nn.Module):
         return self.fft.apply(x, self.inverse, self.centered, self.dims)
 
 
+class FilterModel(nn.Module):
+    def __init__(self, inverse, centered, dims):
+        super(FilterModel, self).__init__()
+        self.inverse = inverse
+        self.centered = centered
+        self.dims = dims
+        self.fft = FFT()
+        self.complex_mul = ComplexMul()
+
+    def forward(self, x, y):
+        x = self.fft.apply(x, self.inverse, self.centered, self.dims)
+        x = self.complex_mul.apply(x, y)
+        return self.fft.apply(x, not self.inverse, self.centered, self.dims)
+
+
 def export(shape, inverse, centered, dims):
     np.random.seed(324)
     torch.manual_seed(32)
@@ -39,6 +55,25 @@ def export(shape, inverse, centered, dims):
     return [inp.detach().numpy()], ref.detach().numpy()
 
 
+def export_filter(shape, filter_shape, inverse, centered, dims):
+    np.random.seed(324)
+    torch.manual_seed(32)
+
+    model = FilterModel(inverse, centered, dims)
+    inp = Variable(torch.randn(shape))
+    inp1 = Variable(torch.randn(filter_shape))
+    model.eval()
+
+    with torch.no_grad():
+        torch.onnx.export(model, (inp, inp1), 'model.onnx',
+                          input_names=['input', 'input1'],
+                          output_names=['output'],
+                          operator_export_type=torch.onnx.OperatorExportTypes.ONNX_FALLTHROUGH)
+
+    ref = model(inp, inp1)
+    return [inp.detach().numpy(), inp1.detach().numpy()], ref.detach().numpy()
+
+
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(description='Generate ONNX model and test data')
     parser.add_argument('--shape', type=int, nargs='+', default=[5, 3, 6, 8, 2])
@@ -0,0 +1,49 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import argparse
+import torch
+import torch.nn as nn
+from .grid_sample import GridSample
+
+class MyModel(nn.Module):
+    def __init__(self, mode, padding_mode, align_corners):
+        super(MyModel, self).__init__()
+        self.mode = mode
+        self.padding_mode = padding_mode
+        self.align_corners = align_corners
+
+    def forward(self, x, grid):
+        return GridSample.apply(x, grid, self.mode, self.padding_mode, self.align_corners)
+
+def export(inp_shape=[1, 3, 7, 9], out_size=[5, 6], mode='bilinear', padding_mode='zeros', align_corners=True):
+    np.random.seed(324)
+    torch.manual_seed(32)
+
+    model = MyModel(mode, padding_mode, align_corners)
+    inp = torch.randn(inp_shape)
+    # the grid goes beyond [-1, 1] to sample the padding as well
+    grid = torch.rand([inp_shape[0]] + out_size + [2]) * 2.4 - 1.2
+    model.eval()
+
+    with torch.no_grad():
+        torch.onnx.export(model, (inp, grid), 'model.onnx',
+                          input_names=['input', 'input1'],
+                          output_names=['output'],
+                          operator_export_type=torch.onnx.OperatorExportTypes.ONNX_ATEN_FALLBACK)
+
+    ref = model(inp, grid)
+    return [inp.detach().numpy(), grid.detach().numpy()], ref.detach().numpy()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Generate ONNX model and test data')
+    parser.add_argument('--inp_shape', type=int, nargs='+', default=[1, 3, 7, 9])
+    parser.add_argument('--out_size', type=int, nargs='+', default=[5, 6])
+    parser.add_argument('--mode', type=str, default='bilinear', choices=['bilinear', 'nearest', 'bicubic'])
+    parser.add_argument('--padding_mode', type=str, default='zeros', choices=['zeros', 'border', 'reflection'])
+    parser.add_argument('--align_corners', type=int, default=1)
+    args = parser.parse_args()
+
+    export(args.inp_shape, args.out_size, args.mode, args.padding_mode, bool(args.align_corners))
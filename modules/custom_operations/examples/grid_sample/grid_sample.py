@@ -0,0 +1,16 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+import torch.nn as nn
+import torch.nn.functional as F
+
+class GridSample(torch.autograd.Function):
+    @staticmethod
+    def symbolic(g, input_tensor, grid, mode, padding_mode, align_corners):
+        return g.op("CustomGridSample", input_tensor, grid, mode_s=mode, padding_mode_s=padding_mode,
+                          align_corners_i=int(align_corners))
+
+    @staticmethod
+    def forward(self, input_tensor, grid, mode, padding_mode, align_corners):
+        return F.grid_sample(input_tensor, grid, mode=mode, padding_mode=padding_mode, align_corners=align_corners)
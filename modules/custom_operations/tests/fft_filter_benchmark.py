@@ -0,0 +1,92 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Measures latency of the fused FFTFilter against the FFT -> ComplexMultiplication -> inverse FFT chain
+it replaces, on MRI-like [batch, coils, height, width, 2] k-space data. Outputs of both models are compared.
+
+Usage example:
+    CUSTOM_OP_LIB=/path/to/libuser_ov_extensions.so python fft_filter_benchmark.py --size 320 640 --coils 8 16
+"""
+
+import argparse
+import os
+import time
+
+import numpy as np
+from openvino import Core, Model, PartialShape, Type
+from openvino.runtime import op
+from openvino.runtime.utils.node_factory import NodeFactory
+
+
+BATCH = 2
+SIGNAL_DIMS = [2, 3]
+
+
+def make_models(factory: NodeFactory, centered: bool):
+    data = op.Parameter(Type.f32, PartialShape([-1, -1, -1, -1, 2]))
+    weights = op.Parameter(Type.f32, PartialShape([-1, 1, -1, -1, 2]))
+    dims = op.Constant(np.array(SIGNAL_DIMS, dtype=np.int32))
+
+    forward = factory.create("FFT", [data.output(0), dims.output(0)], {"inverse": 0, "centered": int(centered)})
+    mul = factory.create("ComplexMultiplication", [forward.output(0), weights.output(0)])
+    inverse = factory.create("FFT", [mul.output(0), dims.output(0)], {"inverse": 1, "centered": int(centered)})
+    chain = Model(inverse.outputs(), [data, weights], "chain")
+
+    data = op.Parameter(Type.f32, PartialShape([-1, -1, -1, -1, 2]))
+    weights = op.Parameter(Type.f32, PartialShape([-1, 1, -1, -1, 2]))
+    fused = factory.create("FFTFilter", [data.output(0), weights.output(0), dims.output(0)],
+                           {"inverse": 0, "centered": int(centered)})
+    return chain, Model(fused.outputs(), [data, weights], "fused")
+
+
+def measure(compiled_model, inputs, repeat: int) -> float:
+    infer_request = compiled_model.create_infer_request()
+    infer_request.infer(inputs)  # warm up
+
+    start = time.perf_counter()
+    for _ in range(repeat):
+        infer_request.infer(inputs)
+    return (time.perf_counter() - start) / repeat
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--size", type=int, nargs="+", default=[256, 320, 640])
+    parser.add_argument("--coils", type=int, nargs="+", default=[8, 16])
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 4])
+    parser.add_argument("--centered", action="store_true")
+    parser.add_argument("--repeat", type=int, default=10)
+    args = parser.parse_args()
+
+    ext_path = os.getenv("CUSTOM_OP_LIB")
+    core = Core()
+    core.add_extension(ext_path)
+    factory = NodeFactory()
+    factory.add_extension(ext_path)
+    chain, fused = make_models(factory, args.centered)
+
+    rng = np.random.default_rng(324)
+    print(f"{'size':>6} {'coils':>6} {'threads':>8} {'chain, ms':>10} {'fused, ms':>10} {'speedup':>8}")
+    for size in args.size:
+        for coils in args.coils:
+            data = rng.standard_normal([BATCH, coils, size, size, 2]).astype(np.float32)
+            weights = rng.standard_normal([BATCH, 1, size, size, 2]).astype(np.float32)
+            inputs = [data, weights]
+
+            for num_threads in args.threads:
+                config = {"INFERENCE_NUM_THREADS": num_threads}
+                compiled_chain = core.compile_model(chain, "CPU", config)
+                compiled_fused = core.compile_model(fused, "CPU", config)
+                expected = compiled_chain(inputs)[0]
+                result = compiled_fused(inputs)[0]
+                assert np.allclose(result, expected, atol=1e-4), "FFTFilter output differs from the chain"
+
+                chain_time = measure(compiled_chain, inputs, args.repeat)
+                fused_time = measure(compiled_fused, inputs, args.repeat)
+                print(f"{size:>6} {coils:>6} {num_threads:>8} {chain_time * 1000:>10.2f} {fused_time * 1000:>10.2f} "
+                      f"{chain_time / fused_time:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
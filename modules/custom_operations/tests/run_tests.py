@@ -39,20 +39,35 @@ def run_test(ref_inputs, ref_res, test_onnx=False, threshold=1e-5):
 @pytest.mark.parametrize("inverse", [False, True])
 @pytest.mark.parametrize("centered", [False, True])
 @pytest.mark.parametrize("test_onnx", [False, True])
-@pytest.mark.parametrize("dims", [[1], [1, 2], [2, 3]])
+@pytest.mark.parametrize("dims", [[1], [1, 2], [2, 3], [0, 2], [3]])
 def test_fft(shape, inverse, centered, test_onnx, dims):
     from examples.fft.export_model import export
 
-    if len(shape) == 3 and dims != [1] or \
-       len(shape) == 4 and dims == [2, 3] or \
-       len(shape) == 5 and dims == [1] or \
-       centered and len(dims) != 2:
-        pytest.skip("unsupported configuration")
+    # the last dimension holds real and imaginary parts
+    if max(dims) >= len(shape) - 1:
+        pytest.skip("signal dimension is out of range")
 
     inp, ref = export(shape, inverse, centered, dims)
     run_test(inp, ref, test_onnx=test_onnx)
 
 
+@pytest.mark.parametrize("filter_channels", [1, 4])
+@pytest.mark.parametrize("inverse", [False, True])
+@pytest.mark.parametrize("centered", [False, True])
+@pytest.mark.parametrize("test_onnx", [False, True])
+@pytest.mark.parametrize("dims", [[2, 3], [1, 2]])
+def test_fft_filter(filter_channels, inverse, centered, test_onnx, dims):
+    from examples.fft.export_model import export_filter
+
+    inp, ref = export_filter([2, 4, 16, 30, 2], [2, filter_channels, 16, 30, 2], inverse, centered, dims)
+    run_test(inp, ref, test_onnx=test_onnx, threshold=1e-4)
+
+    core = Core()
+    core.add_extension(os.getenv('CUSTOM_OP_LIB'))
+    op_types = [node.get_type_name() for node in core.read_model('model.onnx').get_ops()]
+    assert "FFTFilter" in op_types and "FFT" not in op_types
+
+
 @pytest.mark.parametrize("shape", [[3, 2, 4, 8, 2], [3, 1, 4, 8, 2]])
 @pytest.mark.parametrize("test_onnx", [False, True])
 def test_complex_mul(shape, test_onnx):
@@ -90,3 +105,31 @@ def test_calculate_grid():
     from examples.calculate_grid.export_model import export
     inp, ref = export(num_points=10, max_grid_extent=5)
     run_test(inp, ref, test_onnx=True)
+
+
+@pytest.mark.parametrize("inp_shape", [[1, 3, 7, 9], [2, 20, 12, 10]])
+@pytest.mark.parametrize("mode", ["bilinear", "nearest", "bicubic"])
+@pytest.mark.parametrize("padding_mode", ["zeros", "border", "reflection"])
+@pytest.mark.parametrize("align_corners", [False, True])
+@pytest.mark.parametrize("test_onnx", [False, True])
+def test_grid_sample(inp_shape, mode, padding_mode, align_corners, test_onnx):
+    from examples.grid_sample.export_model import export
+
+    inp, ref = export(inp_shape, [5, 6], mode, padding_mode, align_corners)
+    run_test(inp, ref, test_onnx=test_onnx, threshold=1e-4)
+
+
+@pytest.mark.parametrize("mode", ["bilinear", "nearest", "bicubic"])
+def test_grid_sample_outside_non_finite(mode):
+    import torch
+    from examples.grid_sample.export_model import export
+
+    # all taps are outside the input, so the inf and NaN in it don't get to the output with zeros padding
+    export([1, 3, 7, 9], [5, 6], mode, 'zeros', True)
+    inp = torch.randn([1, 3, 7, 9])
+    inp[:, :, 0, 0] = float('inf')
+    inp[:, :, 0, 1] = float('nan')
+    grid = torch.sign(torch.rand([1, 5, 6, 2]) - 0.5) * (torch.rand([1, 5, 6, 2]) + 2)
+    ref = torch.nn.functional.grid_sample(inp, grid, mode=mode, padding_mode='zeros', align_corners=True)
+    assert torch.isfinite(ref).all()
+    run_test([inp.numpy(), grid.numpy()], ref.numpy(), test_onnx=True)
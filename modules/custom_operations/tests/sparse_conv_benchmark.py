@@ -0,0 +1,104 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Measures latency of SparseConv and SparseConvTranspose on random point clouds of LiDAR-like density
+for several point counts and kernel sizes. Results of the small clouds are checked against a brute-force
+numpy implementation. Run it with builds of the extension before and after a change to compare them.
+
+Usage example:
+    CUSTOM_OP_LIB=/path/to/libuser_ov_extensions.so python sparse_conv_benchmark.py --points 10000 100000 --kernel-size 3 5
+"""
+
+import argparse
+import os
+import time
+
+import numpy as np
+from openvino import Core, Model, PartialShape, Type
+from openvino.runtime import op
+from openvino.runtime.utils.node_factory import NodeFactory
+
+
+IN_CHANNELS = 8
+FILTERS = 16
+POINTS_PER_VOXEL = 0.5
+MAX_CHECKED_POINTS = 5000
+
+
+def make_model(factory: NodeFactory, operation: str, kernel: np.ndarray) -> Model:
+    features = op.Parameter(Type.f32, PartialShape([-1, IN_CHANNELS]))
+    inp_pos = op.Parameter(Type.f32, PartialShape([-1, 3]))
+    out_pos = op.Parameter(Type.f32, PartialShape([-1, 3]))
+    kernel_node = op.Constant(kernel)
+    offset = op.Constant(np.zeros(3, dtype=np.float32))
+    conv = factory.create(operation, [features.output(0), inp_pos.output(0), out_pos.output(0),
+                                      kernel_node.output(0), offset.output(0)])
+    return Model(conv.outputs(), [features, inp_pos, out_pos], operation)
+
+
+def reference(operation: str, features: np.ndarray, inp_pos: np.ndarray, out_pos: np.ndarray,
+              kernel: np.ndarray) -> np.ndarray:
+    kernel_dims = np.array(kernel.shape[2::-1])  # kernel is DxHxWxICxOC, positions are XYZ
+    radius = kernel_dims * 0.51
+    out = np.zeros([len(out_pos), kernel.shape[4]], dtype=np.float32)
+    for i, position in enumerate(out_pos):
+        delta = inp_pos - position
+        inside = np.all(np.abs(delta) <= radius, axis=1)
+        cells = np.minimum((delta[inside] + kernel_dims * 0.5).astype(np.int32), kernel_dims - 1)
+        if operation == "SparseConvTranspose":
+            cells = kernel_dims - 1 - cells
+        weights = kernel[cells[:, 2], cells[:, 1], cells[:, 0]]  # [neighbours, IC, OC]
+        out[i] = np.einsum("ni,nio->o", features[inside], weights)
+    return out
+
+
+def measure(compiled_model, inputs, repeat: int) -> float:
+    infer_request = compiled_model.create_infer_request()
+    infer_request.infer(inputs)  # warm up
+
+    start = time.perf_counter()
+    for _ in range(repeat):
+        infer_request.infer(inputs)
+    return (time.perf_counter() - start) / repeat
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--points", type=int, nargs="+", default=[1000, 10000, 100000])
+    parser.add_argument("--kernel-size", type=int, nargs="+", default=[3, 5])
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 4])
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    ext_path = os.getenv("CUSTOM_OP_LIB")
+    core = Core()
+    core.add_extension(ext_path)
+    factory = NodeFactory()
+    factory.add_extension(ext_path)
+
+    rng = np.random.default_rng(324)
+    print(f"{'operation':>20} {'points':>8} {'kernel':>7} {'threads':>8} {'latency, ms':>12}")
+    for kernel_size in args.kernel_size:
+        kernel = rng.standard_normal([kernel_size] * 3 + [IN_CHANNELS, FILTERS]).astype(np.float32)
+        for num_points in args.points:
+            extent = (num_points / POINTS_PER_VOXEL) ** (1 / 3)
+            features = rng.standard_normal([num_points, IN_CHANNELS]).astype(np.float32)
+            positions = (rng.random([num_points, 3]) * extent).astype(np.float32)
+            inputs = [features, positions, positions]
+
+            for operation in ("SparseConv", "SparseConvTranspose"):
+                model = make_model(factory, operation, kernel)
+                for num_threads in args.threads:
+                    compiled_model = core.compile_model(model, "CPU", {"INFERENCE_NUM_THREADS": num_threads})
+                    if num_points <= MAX_CHECKED_POINTS:
+                        expected = reference(operation, features, positions, positions, kernel)
+                        result = compiled_model(inputs)[0]
+                        assert np.allclose(result, expected, atol=1e-3), f"{operation} output is incorrect"
+
+                    elapsed = measure(compiled_model, inputs, args.repeat)
+                    print(f"{operation:>20} {num_points:>8} {kernel_size:>7} {num_threads:>8} {elapsed * 1000:>12.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,13 @@
 
 #include "calculate_grid.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <openvino/core/parallel.hpp>
+
 using namespace TemplateExtension;
 
 CalculateGrid::CalculateGrid(const ov::Output<ov::Node>& inp_pos) : Op({inp_pos}) {
@@ -20,43 +27,130 @@ std::shared_ptr<ov::Node> CalculateGrid::clone_with_new_inputs(const ov::OutputV
     return std::make_shared<CalculateGrid>(new_args.at(0));
 }
 
+namespace {
+
+// Every axis has the candidates int(x) - 1 and int(x) of different parity, and only an even non-negative one is valid.
+// So a point gives at most one grid position: the greatest even value not above int(x) on every axis.
+bool gridCoord(float value, int& coord) {
+    const int truncated = static_cast<int>(value);
+    coord = truncated - (truncated & 1);
+    return coord >= 0;
+}
+
+// Stable LSD radix sort by the lowest numBits bits of the keys. Every pass counts digits of blocks in parallel,
+// then blocks scatter their keys to the offsets computed in block order.
+void radixSort(std::vector<uint64_t>& keys, int numBits) {
+    const size_t size = keys.size();
+    const size_t numBlocks = std::max<size_t>(1, std::min<size_t>(64, size / 4096));
+    const size_t blockSize = (size + numBlocks - 1) / numBlocks;
+    const size_t numDigits = 256;
+    std::vector<uint64_t> sorted(size);
+    std::vector<size_t> offsets(numBlocks * numDigits);
+
+    for (int shift = 0; shift < numBits; shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        ov::parallel_for(numBlocks, [&](size_t block) {
+            size_t* counts = offsets.data() + block * numDigits;
+            for (size_t i = block * blockSize; i < std::min(size, (block + 1) * blockSize); ++i) {
+                ++counts[(keys[i] >> shift) & 0xFF];
+            }
+        });
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < numDigits; ++digit) {
+            for (size_t block = 0; block < numBlocks; ++block) {
+                const size_t count = offsets[block * numDigits + digit];
+                offsets[block * numDigits + digit] = offset;
+                offset += count;
+            }
+        }
+
+        ov::parallel_for(numBlocks, [&](size_t block) {
+            size_t* positions = offsets.data() + block * numDigits;
+            for (size_t i = block * blockSize; i < std::min(size, (block + 1) * blockSize); ++i) {
+                sorted[positions[(keys[i] >> shift) & 0xFF]++] = keys[i];
+            }
+        });
+        keys.swap(sorted);
+    }
+}
+
+}  // namespace
+
 bool CalculateGrid::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
     const float* inpPos = reinterpret_cast<float*>(inputs[0].data());
     float* out = reinterpret_cast<float*>(outputs[0].data());
 
-    std::set<std::tuple<int, int, int> > outPos;
-
     const size_t numPoints = inputs[0].get_shape()[0];
-    static const std::vector<std::vector<int> > filters {{-1, -1, -1}, {-1, -1, 0}, {-1, 0, -1},
-                                                         {-1, 0, 0}, {0, -1, -1}, {0, -1, 0},
-                                                         {0, 0, -1}, {0, 0, 0}};
 
-    std::vector<int> pos(3);
+    std::vector<int> coords(numPoints * 3);
+    std::vector<char> isValid(numPoints);
+    ov::parallel_for(numPoints, [&](size_t i) {
+        isValid[i] = gridCoord(inpPos[i * 3], coords[i * 3]) &
+                     gridCoord(inpPos[i * 3 + 1], coords[i * 3 + 1]) &
+                     gridCoord(inpPos[i * 3 + 2], coords[i * 3 + 2]);
+    });
+
+    int maxCoord = 0;
     for (size_t i = 0; i < numPoints; ++i) {
-        for (size_t j = 0; j < filters.size(); ++j) {
-            bool isValid = true;
-            for (size_t k = 0; k < 3; ++k) {
-                int val = static_cast<int>(inpPos[i * 3 + k]) + filters[j][k];
-                if (val < 0 || val % 2) {
-                    isValid = false;
-                    break;
-                }
-                pos[k] = val;
+        if (isValid[i]) {
+            maxCoord = std::max(maxCoord, std::max(coords[i * 3], std::max(coords[i * 3 + 1], coords[i * 3 + 2])));
+        }
+    }
+    int coordBits = 1;
+    while (coordBits < 31 && (maxCoord >> coordBits) != 0) {
+        ++coordBits;
+    }
+
+    // Output positions are ordered by (x, y, z) as they were in std::set of tuples
+    std::vector<std::tuple<int, int, int> > outPos;
+    if (3 * coordBits <= 64) {
+        // Packed keys compare in the same order as the tuples
+        std::vector<uint64_t> keys(numPoints);
+        ov::parallel_for(numPoints, [&](size_t i) {
+            keys[i] = (static_cast<uint64_t>(coords[i * 3]) << (2 * coordBits)) |
+                      (static_cast<uint64_t>(coords[i * 3 + 1]) << coordBits) |
+                      static_cast<uint64_t>(coords[i * 3 + 2]);
+        });
+        size_t numKeys = 0;
+        for (size_t i = 0; i < numPoints; ++i) {
+            if (isValid[i]) {
+                keys[numKeys++] = keys[i];
+            }
+        }
+        keys.resize(numKeys);
+        radixSort(keys, 3 * coordBits);
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        const uint64_t coordMask = (uint64_t(1) << coordBits) - 1;
+        outPos.resize(keys.size());
+        ov::parallel_for(keys.size(), [&](size_t i) {
+            outPos[i] = std::make_tuple(static_cast<int>(keys[i] >> (2 * coordBits)),
+                                        static_cast<int>((keys[i] >> coordBits) & coordMask),
+                                        static_cast<int>(keys[i] & coordMask));
+        });
+    } else {
+        // too large grid for 64-bit keys
+        for (size_t i = 0; i < numPoints; ++i) {
+            if (isValid[i]) {
+                outPos.push_back(std::make_tuple(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]));
             }
-            if (isValid)
-                outPos.insert(std::make_tuple(pos[0], pos[1], pos[2]));
         }
+        std::sort(outPos.begin(), outPos.end());
+        outPos.erase(std::unique(outPos.begin(), outPos.end()), outPos.end());
     }
 
-    int i = 0;
-    for (const auto& it : outPos) {
-        out[i * 3] = 0.5f + std::get<0>(it);
-        out[i * 3 + 1] = 0.5f + std::get<1>(it);
-        out[i * 3 + 2] = 0.5f + std::get<2>(it);
-        i += 1;
+    const size_t numOutPoints = outPos.size();
+    ov::parallel_for(numOutPoints, [&](size_t i) {
+        out[i * 3] = 0.5f + std::get<0>(outPos[i]);
+        out[i * 3 + 1] = 0.5f + std::get<1>(outPos[i]);
+        out[i * 3 + 2] = 0.5f + std::get<2>(outPos[i]);
+    });
+    memset(out + numOutPoints * 3, 0, sizeof(float) * 3 * (numPoints - numOutPoints));
+    // the sentinel marks the end of the positions if there is room for it
+    if (numOutPoints < numPoints) {
+        out[numOutPoints * 3] = -1.0f;
     }
-    memset(out + i * 3, 0, sizeof(float) * 3 * (numPoints - i));
-    out[i * 3] = -1.0f;
     return true;
 }
 
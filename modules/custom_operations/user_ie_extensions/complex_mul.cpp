@@ -35,29 +35,14 @@ bool ComplexMultiplication::evaluate(ov::TensorVector& outputs, const ov::Tensor
     // x2 = x_r * y_i + x_i * y_r
     if (channels0 == channels1)
         ov::parallel_for(channels0 * batch, [&](size_t ch) {
-            for (size_t i = 0; i < spatialSize; ++i) {
-                    size_t outIdx = (ch * spatialSize + i) * 2;
-                    float real0 = inp0[outIdx];
-                    float imag0 = inp0[outIdx + 1];
-                    float real1 = inp1[outIdx];
-                    float imag1 = inp1[outIdx + 1];
-                    out[outIdx] = real0 * real1 - imag0 * imag1;
-                    out[outIdx + 1] = real0 * imag1 + imag0 * real1;
-            }
+            const size_t offset = ch * spatialSize * 2;
+            multiplyComplex(inp0 + offset, inp1 + offset, out + offset, spatialSize);
         });
     else if (channels1 == 1)
         ov::parallel_for(channels0 * batch, [&](size_t ch) {
             size_t b = ch / channels0;
-            for (size_t i = 0; i < spatialSize; ++i) {
-                size_t outIdx = (ch * spatialSize + i) * 2;
-                size_t inpIdx = (b * spatialSize + i) * 2;
-                float real0 = inp0[outIdx];
-                float imag0 = inp0[outIdx + 1];
-                float real1 = inp1[inpIdx];
-                float imag1 = inp1[inpIdx + 1];
-                out[outIdx] = real0 * real1 - imag0 * imag1;
-                out[outIdx + 1] = real0 * imag1 + imag0 * real1;
-            }
+            const size_t offset = ch * spatialSize * 2;
+            multiplyComplex(inp0 + offset, inp1 + b * spatialSize * 2, out + offset, spatialSize);
         });
     else
         OPENVINO_THROW("Wrong number of channels for second input!");
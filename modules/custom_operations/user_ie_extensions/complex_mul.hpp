@@ -4,10 +4,39 @@
 
 #pragma once
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define COMPLEX_MUL_USE_SSE2
+#endif
+
 #include <openvino/op/op.hpp>
 
 namespace TemplateExtension {
 
+// Multiplies count interleaved complex numbers, out may be the same as lhs or rhs
+inline void multiplyComplex(const float* lhs, const float* rhs, float* out, size_t count) {
+    size_t i = 0;
+#if defined(COMPLEX_MUL_USE_SSE2)
+    // (a + bi)(c + di) = (ac - bd) + (bc + ad)i is [a, b] * [c, c] + [b, a] * [d, d] with the negated real part
+    const __m128 signs = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    for (; i + 2 <= count; i += 2) {
+        const __m128 a = _mm_loadu_ps(lhs + i * 2);
+        const __m128 b = _mm_loadu_ps(rhs + i * 2);
+        const __m128 bRe = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 bIm = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128 aSwapped = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 cross = _mm_xor_ps(_mm_mul_ps(aSwapped, bIm), signs);
+        _mm_storeu_ps(out + i * 2, _mm_add_ps(_mm_mul_ps(a, bRe), cross));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float re = lhs[i * 2] * rhs[i * 2] - lhs[i * 2 + 1] * rhs[i * 2 + 1];
+        const float im = lhs[i * 2] * rhs[i * 2 + 1] + lhs[i * 2 + 1] * rhs[i * 2];
+        out[i * 2] = re;
+        out[i * 2 + 1] = im;
+    }
+}
+
 class ComplexMultiplication : public ov::op::Op {
 public:
     OPENVINO_OP("ComplexMultiplication");
@@ -6,6 +6,8 @@
 
 #include <openvino/op/op.hpp>
 
+#include "fft_plan.hpp"
+
 namespace TemplateExtension {
 
 class FFT : public ov::op::Op {
@@ -21,9 +23,18 @@ public:
     bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
     bool has_evaluate() const override;
 
+    bool is_inverse() const {
+        return inverse;
+    }
+    bool is_centered() const {
+        return centered;
+    }
+
 private:
     bool inverse = false;
     bool centered = false;
+
+    mutable FFTPlanCache plans;
 };
 
 }  // namespace TemplateExtension
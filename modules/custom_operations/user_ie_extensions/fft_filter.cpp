@@ -0,0 +1,203 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft_filter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <openvino/core/graph_util.hpp>
+#include <openvino/core/parallel.hpp>
+#include <openvino/core/rt_info.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "complex_mul.hpp"
+#include "fft.hpp"
+
+using namespace TemplateExtension;
+
+namespace {
+
+struct AxisTransform {
+    std::shared_ptr<const FFTPlan> plan;
+    size_t outer;  // lines of the tile
+    size_t inner;
+};
+
+// Transforms a tile along all signal axes, the first axis reads src and the next ones work in place
+void transformTile(const std::vector<AxisTransform>& transforms, const float* src, float* dst, size_t tileSize,
+                   bool inverse, bool centered) {
+    if (transforms.empty() && src != dst)
+        memcpy(dst, src, tileSize * 2 * sizeof(float));
+
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        const AxisTransform& transform = transforms[i];
+        ov::parallel_for(numLineBlocks(transform.outer, transform.inner), [&](size_t block) {
+            transformLineBlock(*transform.plan, src, dst, transform.outer, transform.inner, block, inverse, centered);
+        });
+        src = dst;
+    }
+}
+
+}  // namespace
+
+FFTFilter::FFTFilter(const ov::OutputVector& args, bool inverse, bool centered) : Op(args) {
+    constructor_validate_and_infer_types();
+    this->inverse = inverse;
+    this->centered = centered;
+}
+
+void FFTFilter::validate_and_infer_types() {
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+std::shared_ptr<ov::Node> FFTFilter::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    OPENVINO_ASSERT(new_args.size() == 3, "Incorrect number of new arguments");
+    return std::make_shared<FFTFilter>(new_args, inverse, centered);
+}
+
+bool FFTFilter::visit_attributes(ov::AttributeVisitor& visitor) {
+    int inverse_i = static_cast<int>(inverse);
+    int centered_i = static_cast<int>(centered);
+    visitor.on_attribute("inverse", inverse_i);
+    visitor.on_attribute("centered", centered_i);
+    inverse = static_cast<bool>(inverse_i);
+    centered = static_cast<bool>(centered_i);
+    return true;
+}
+
+bool FFTFilter::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    const float* inpData = reinterpret_cast<float*>(inputs[0].data());
+    const float* filterData = reinterpret_cast<float*>(inputs[1].data());
+
+    if (inputs[2].get_element_type() != ov::element::i32)
+        OPENVINO_THROW("Unexpected dims type: " + inputs[2].get_element_type().to_string());
+
+    const int32_t* signalDimsData = reinterpret_cast<int32_t*>(inputs[2].data());
+    float* outData = reinterpret_cast<float*>(outputs[0].data());
+    const std::vector<size_t> dims = inputs[0].get_shape();
+    const std::vector<size_t> filterDims = inputs[1].get_shape();
+    const size_t numSignalDims = inputs[2].get_size();
+
+    OPENVINO_ASSERT(dims.size() == 5 && dims[4] == 2, "FFTFilter expects [N, C, H, W, 2] input, got ",
+                    inputs[0].get_shape());
+    OPENVINO_ASSERT(filterDims.size() == 5 && filterDims[0] == dims[0] && filterDims[2] == dims[2] &&
+                    filterDims[3] == dims[3] && filterDims[4] == 2 && (filterDims[1] == dims[1] || filterDims[1] == 1),
+                    "FFTFilter expects [N, C, H, W, 2] or [N, 1, H, W, 2] filter, got ", inputs[1].get_shape());
+    // dimensions of the complex tensor
+    const int64_t rank = 4;
+
+    std::vector<int64_t> axes(numSignalDims);
+    for (size_t i = 0; i < numSignalDims; ++i) {
+        axes[i] = signalDimsData[i] < 0 ? signalDimsData[i] + rank : signalDimsData[i];
+        OPENVINO_ASSERT(0 <= axes[i] && axes[i] < rank, "FFTFilter signal dimension ", signalDimsData[i],
+                        " is out of range for input dims ", inputs[0].get_shape());
+    }
+
+    const size_t numElements = dims[0] * dims[1] * dims[2] * dims[3];
+    if (numElements == 0)
+        return true;
+
+    // a tile covers the dimensions from the first signal dim, so all transforms of a tile stay inside it
+    const int64_t firstAxis = axes.empty() ? rank : *std::min_element(axes.begin(), axes.end());
+    size_t numTiles = 1;
+    for (int64_t d = 0; d < firstAxis; ++d)
+        numTiles *= dims[d];
+    const size_t tileSize = numElements / numTiles;
+
+    std::vector<AxisTransform> transforms(axes.size());
+    for (size_t i = 0; i < axes.size(); ++i) {
+        transforms[i].plan = plans.get(dims[axes[i]]);
+        transforms[i].outer = 1;
+        transforms[i].inner = 1;
+        for (int64_t d = firstAxis; d < axes[i]; ++d)
+            transforms[i].outer *= dims[d];
+        for (int64_t d = axes[i] + 1; d < rank; ++d)
+            transforms[i].inner *= dims[d];
+    }
+
+    const size_t channels = dims[1];
+    const size_t planeSize = dims[2] * dims[3];
+    const bool broadcastFilter = filterDims[1] != channels;
+
+    ov::parallel_for(numTiles, [&](size_t tile) {
+        const size_t begin = tile * tileSize;
+        const size_t end = begin + tileSize;
+        float* tileData = outData + begin * 2;
+
+        transformTile(transforms, inpData + begin * 2, tileData, tileSize, inverse, centered);
+
+        // the filter is indexed as in ComplexMultiplication, by planes of the spatial dimensions
+        for (size_t pos = begin; pos < end;) {
+            const size_t plane = pos / planeSize;
+            const size_t planePos = pos % planeSize;
+            const size_t count = std::min(end - pos, planeSize - planePos);
+            const size_t filterPlane = broadcastFilter ? plane / channels : plane;
+            multiplyComplex(outData + pos * 2, filterData + (filterPlane * planeSize + planePos) * 2,
+                            outData + pos * 2, count);
+            pos += count;
+        }
+
+        transformTile(transforms, tileData, tileData, tileSize, !inverse, centered);
+    });
+    return true;
+}
+
+bool FFTFilter::has_evaluate() const {
+    return get_input_element_type(0) == ov::element::f32 && get_input_element_type(1) == ov::element::f32 &&
+           get_input_element_type(2) == ov::element::i32;
+}
+
+FuseFFTFilter::FuseFFTFilter() {
+    using namespace ov::pass::pattern;
+
+    const auto data = any_input();
+    const auto firstDims = wrap_type<ov::op::v0::Constant>();
+    const auto first = wrap_type<FFT>({data, firstDims}, consumers_count(1));
+    const auto filter = any_input();
+    const auto mul = wrap_type<ComplexMultiplication>({first, filter}, consumers_count(1));
+    const auto secondDims = wrap_type<ov::op::v0::Constant>();
+    const auto second = wrap_type<FFT>({mul, secondDims});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& values = m.get_pattern_value_map();
+        const auto firstFFT = ov::as_type_ptr<FFT>(values.at(first).get_node_shared_ptr());
+        const auto secondFFT = ov::as_type_ptr<FFT>(m.get_match_root());
+        if (!firstFFT || !secondFFT || firstFFT->is_inverse() == secondFFT->is_inverse() ||
+            firstFFT->is_centered() != secondFFT->is_centered())
+            return false;
+
+        const auto firstAxes =
+            ov::as_type_ptr<ov::op::v0::Constant>(values.at(firstDims).get_node_shared_ptr())->cast_vector<int64_t>();
+        const auto secondAxes =
+            ov::as_type_ptr<ov::op::v0::Constant>(values.at(secondDims).get_node_shared_ptr())->cast_vector<int64_t>();
+        if (firstAxes != secondAxes)
+            return false;
+
+        // ComplexMultiplication works with [N, C, H, W, 2] inputs only
+        const auto& dataShape = values.at(data).get_partial_shape();
+        if (dataShape.rank().is_dynamic() || dataShape.rank().get_length() != 5)
+            return false;
+
+        const auto fused = std::make_shared<FFTFilter>(
+            ov::OutputVector{values.at(data), values.at(filter), values.at(firstDims)},
+            firstFFT->is_inverse(),
+            firstFFT->is_centered());
+        fused->set_friendly_name(secondFFT->get_friendly_name());
+        ov::copy_runtime_info({firstFFT, values.at(mul).get_node_shared_ptr(), secondFFT}, fused);
+        ov::replace_node(secondFFT, fused);
+        return true;
+    };
+
+    register_matcher(std::make_shared<Matcher>(second, "FuseFFTFilter"), callback);
+}
+
+bool TemplateExtension::fuseFFTFilter(std::shared_ptr<ov::Model> model) {
+    ov::pass::Manager manager;
+    manager.register_pass<FuseFFTFilter>();
+    manager.run_passes(model);
+    return true;
+}
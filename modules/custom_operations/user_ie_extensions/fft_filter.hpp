@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+#include <openvino/pass/graph_rewrite.hpp>
+
+#include "fft_plan.hpp"
+
+namespace TemplateExtension {
+
+// FFT, ComplexMultiplication by a filter and FFT of the opposite direction over the same signal dims.
+// Inputs are [N, C, H, W, 2] data, [N, C, H, W, 2] or [N, 1, H, W, 2] filter and signal dims.
+// Data is processed by tiles of the dimensions starting from the first signal dim, every tile goes through
+// all three stages while it stays in cache.
+class FFTFilter : public ov::op::Op {
+public:
+    OPENVINO_OP("FFTFilter");
+
+    FFTFilter() = default;
+    FFTFilter(const ov::OutputVector& args, bool inverse, bool centered);
+    void validate_and_infer_types() override;
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
+    bool has_evaluate() const override;
+
+private:
+    // direction of the first transform, the second one is the opposite
+    bool inverse = false;
+    bool centered = false;
+
+    mutable FFTPlanCache plans;
+};
+
+// Replaces FFT -> ComplexMultiplication -> FFT of the opposite direction by FFTFilter
+class FuseFFTFilter : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseFFTFilter", "0");
+    FuseFFTFilter();
+};
+
+// Runs FuseFFTFilter on the models converted by frontends
+bool fuseFFTFilter(std::shared_ptr<ov::Model> model);
+
+}  // namespace TemplateExtension
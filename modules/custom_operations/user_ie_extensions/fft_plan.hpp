@@ -0,0 +1,296 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace TemplateExtension {
+
+// Forward mixed-radix FFT of one signal length with precomputed twiddle factors.
+// A transform runs on a block of signals at once: real and imaginary parts are stored as [size][lanes] arrays,
+// so every butterfly is a loop over lanes which compilers turn into SIMD instructions.
+// Stages follow the Stockham scheme, they ping-pong between two buffers and need no bit reversal.
+class FFTPlan {
+public:
+    static const size_t lanes = 8;
+
+    explicit FFTPlan(size_t size) : m_size(size) {
+        const double pi = std::acos(-1.0);
+        size_t stride = 1;
+        for (size_t length = size; length > 1;) {
+            Stage stage;
+            stage.radix = chooseRadix(length);
+            stage.stride = stride;
+            stage.count = length / stage.radix;
+
+            // twiddle factor of output j of butterfly p is exp(-2 pi i p j / length)
+            stage.twiddlesRe.resize(stage.count * stage.radix);
+            stage.twiddlesIm.resize(stage.count * stage.radix);
+            for (size_t p = 0; p < stage.count; ++p) {
+                for (size_t j = 0; j < stage.radix; ++j) {
+                    const double angle = -2.0 * pi * static_cast<double>((p * j) % length) / length;
+                    stage.twiddlesRe[p * stage.radix + j] = static_cast<float>(std::cos(angle));
+                    stage.twiddlesIm[p * stage.radix + j] = static_cast<float>(std::sin(angle));
+                }
+            }
+            if (stage.radix != 2 && stage.radix != 3 && stage.radix != 4) {
+                stage.rootsRe.resize(stage.radix);
+                stage.rootsIm.resize(stage.radix);
+                for (size_t k = 0; k < stage.radix; ++k) {
+                    const double angle = -2.0 * pi * k / stage.radix;
+                    stage.rootsRe[k] = static_cast<float>(std::cos(angle));
+                    stage.rootsIm[k] = static_cast<float>(std::sin(angle));
+                }
+            }
+
+            m_stages.push_back(stage);
+            length /= stage.radix;
+            stride *= stage.radix;
+        }
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    // Transforms [size][lanes] arrays re and im using the work arrays of the same size.
+    // The pointers are swapped so that re and im point to the result.
+    void transform(float*& re, float*& im, float*& workRe, float*& workIm) const {
+        for (size_t s = 0; s < m_stages.size(); ++s) {
+            const Stage& stage = m_stages[s];
+            switch (stage.radix) {
+            case 2:
+                radix2(stage, re, im, workRe, workIm);
+                break;
+            case 3:
+                radix3(stage, re, im, workRe, workIm);
+                break;
+            case 4:
+                radix4(stage, re, im, workRe, workIm);
+                break;
+            default:
+                radixGeneric(stage, re, im, workRe, workIm);
+            }
+            std::swap(re, workRe);
+            std::swap(im, workIm);
+        }
+    }
+
+private:
+    // Butterfly p of a stage reads elements q + stride * (p + k * count) and writes elements q + stride * (radix * p + j)
+    struct Stage {
+        size_t radix;
+        size_t stride;
+        size_t count;
+        std::vector<float> twiddlesRe, twiddlesIm;  // [count][radix]
+        std::vector<float> rootsRe, rootsIm;        // roots of unity of the generic butterfly
+    };
+
+    static size_t chooseRadix(size_t length) {
+        if (length % 4 == 0)
+            return 4;
+        if (length % 2 == 0)
+            return 2;
+        for (size_t factor = 3; factor * factor <= length; factor += 2) {
+            if (length % factor == 0)
+                return factor;
+        }
+        return length;
+    }
+
+    // Multiplies by the twiddle factor and stores a butterfly output of all lanes
+    static void store(const float* valueRe, const float* valueIm, float twiddleRe, float twiddleIm,
+                      float* dstRe, float* dstIm) {
+        for (size_t l = 0; l < lanes; ++l) {
+            dstRe[l] = valueRe[l] * twiddleRe - valueIm[l] * twiddleIm;
+            dstIm[l] = valueRe[l] * twiddleIm + valueIm[l] * twiddleRe;
+        }
+    }
+
+    static void radix2(const Stage& stage, const float* srcRe, const float* srcIm, float* dstRe, float* dstIm) {
+        const size_t stride = stage.stride, count = stage.count;
+        for (size_t p = 0; p < count; ++p) {
+            for (size_t q = 0; q < stride; ++q) {
+                const size_t a = (q + stride * p) * lanes, b = (q + stride * (p + count)) * lanes;
+                float sumRe[lanes], sumIm[lanes], diffRe[lanes], diffIm[lanes];
+                for (size_t l = 0; l < lanes; ++l) {
+                    sumRe[l] = srcRe[a + l] + srcRe[b + l];
+                    sumIm[l] = srcIm[a + l] + srcIm[b + l];
+                    diffRe[l] = srcRe[a + l] - srcRe[b + l];
+                    diffIm[l] = srcIm[a + l] - srcIm[b + l];
+                }
+                const size_t out = (q + stride * 2 * p) * lanes;
+                store(sumRe, sumIm, 1.0f, 0.0f, dstRe + out, dstIm + out);
+                store(diffRe, diffIm, stage.twiddlesRe[p * 2 + 1], stage.twiddlesIm[p * 2 + 1],
+                      dstRe + out + stride * lanes, dstIm + out + stride * lanes);
+            }
+        }
+    }
+
+    static void radix3(const Stage& stage, const float* srcRe, const float* srcIm, float* dstRe, float* dstIm) {
+        const size_t stride = stage.stride, count = stage.count;
+        const float sin60 = 0.866025403784438647f;
+        for (size_t p = 0; p < count; ++p) {
+            for (size_t q = 0; q < stride; ++q) {
+                const size_t a0 = (q + stride * p) * lanes;
+                const size_t a1 = a0 + stride * count * lanes, a2 = a1 + stride * count * lanes;
+                float outRe[3][lanes], outIm[3][lanes];
+                for (size_t l = 0; l < lanes; ++l) {
+                    const float sumRe = srcRe[a1 + l] + srcRe[a2 + l], sumIm = srcIm[a1 + l] + srcIm[a2 + l];
+                    const float diffRe = srcRe[a1 + l] - srcRe[a2 + l], diffIm = srcIm[a1 + l] - srcIm[a2 + l];
+                    const float midRe = srcRe[a0 + l] - 0.5f * sumRe, midIm = srcIm[a0 + l] - 0.5f * sumIm;
+                    outRe[0][l] = srcRe[a0 + l] + sumRe;
+                    outIm[0][l] = srcIm[a0 + l] + sumIm;
+                    // exp(-+2 pi i / 3) = -1/2 -+ i sin60
+                    outRe[1][l] = midRe + sin60 * diffIm;
+                    outIm[1][l] = midIm - sin60 * diffRe;
+                    outRe[2][l] = midRe - sin60 * diffIm;
+                    outIm[2][l] = midIm + sin60 * diffRe;
+                }
+                for (size_t j = 0; j < 3; ++j) {
+                    const size_t out = (q + stride * (3 * p + j)) * lanes;
+                    store(outRe[j], outIm[j], stage.twiddlesRe[p * 3 + j], stage.twiddlesIm[p * 3 + j],
+                          dstRe + out, dstIm + out);
+                }
+            }
+        }
+    }
+
+    static void radix4(const Stage& stage, const float* srcRe, const float* srcIm, float* dstRe, float* dstIm) {
+        const size_t stride = stage.stride, count = stage.count;
+        for (size_t p = 0; p < count; ++p) {
+            for (size_t q = 0; q < stride; ++q) {
+                const size_t a0 = (q + stride * p) * lanes, step = stride * count * lanes;
+                const size_t a1 = a0 + step, a2 = a1 + step, a3 = a2 + step;
+                float outRe[4][lanes], outIm[4][lanes];
+                for (size_t l = 0; l < lanes; ++l) {
+                    const float sum02Re = srcRe[a0 + l] + srcRe[a2 + l], sum02Im = srcIm[a0 + l] + srcIm[a2 + l];
+                    const float diff02Re = srcRe[a0 + l] - srcRe[a2 + l], diff02Im = srcIm[a0 + l] - srcIm[a2 + l];
+                    const float sum13Re = srcRe[a1 + l] + srcRe[a3 + l], sum13Im = srcIm[a1 + l] + srcIm[a3 + l];
+                    const float diff13Re = srcRe[a1 + l] - srcRe[a3 + l], diff13Im = srcIm[a1 + l] - srcIm[a3 + l];
+                    outRe[0][l] = sum02Re + sum13Re;
+                    outIm[0][l] = sum02Im + sum13Im;
+                    outRe[2][l] = sum02Re - sum13Re;
+                    outIm[2][l] = sum02Im - sum13Im;
+                    // multiplication of diff13 by -i
+                    outRe[1][l] = diff02Re + diff13Im;
+                    outIm[1][l] = diff02Im - diff13Re;
+                    outRe[3][l] = diff02Re - diff13Im;
+                    outIm[3][l] = diff02Im + diff13Re;
+                }
+                for (size_t j = 0; j < 4; ++j) {
+                    const size_t out = (q + stride * (4 * p + j)) * lanes;
+                    store(outRe[j], outIm[j], stage.twiddlesRe[p * 4 + j], stage.twiddlesIm[p * 4 + j],
+                          dstRe + out, dstIm + out);
+                }
+            }
+        }
+    }
+
+    // Direct DFT of odd prime radices
+    static void radixGeneric(const Stage& stage, const float* srcRe, const float* srcIm, float* dstRe, float* dstIm) {
+        const size_t stride = stage.stride, count = stage.count, radix = stage.radix;
+        for (size_t p = 0; p < count; ++p) {
+            for (size_t q = 0; q < stride; ++q) {
+                for (size_t j = 0; j < radix; ++j) {
+                    float accRe[lanes] = {}, accIm[lanes] = {};
+                    for (size_t k = 0; k < radix; ++k) {
+                        const float rootRe = stage.rootsRe[(j * k) % radix], rootIm = stage.rootsIm[(j * k) % radix];
+                        const size_t a = (q + stride * (p + k * count)) * lanes;
+                        for (size_t l = 0; l < lanes; ++l) {
+                            accRe[l] += srcRe[a + l] * rootRe - srcIm[a + l] * rootIm;
+                            accIm[l] += srcRe[a + l] * rootIm + srcIm[a + l] * rootRe;
+                        }
+                    }
+                    const size_t out = (q + stride * (radix * p + j)) * lanes;
+                    store(accRe, accIm, stage.twiddlesRe[p * radix + j], stage.twiddlesIm[p * radix + j],
+                          dstRe + out, dstIm + out);
+                }
+            }
+        }
+    }
+
+    size_t m_size;
+    std::vector<Stage> m_stages;
+};
+
+// Plans of the signal lengths seen by an operation, shared by the threads running it
+class FFTPlanCache {
+public:
+    std::shared_ptr<const FFTPlan> get(size_t size) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::shared_ptr<const FFTPlan>& plan = m_plans[size];
+        if (!plan)
+            plan = std::make_shared<FFTPlan>(size);
+        return plan;
+    }
+
+private:
+    std::map<size_t, std::shared_ptr<const FFTPlan>> m_plans;
+    std::mutex m_mutex;
+};
+
+// Lines of a complex tensor along an axis are enumerated over the outer and inner dimensions around the axis
+// and transformed by blocks of FFTPlan::lanes lines, neighbouring lines of the inner dimensions share cache lines.
+inline size_t numLineBlocks(size_t outer, size_t inner) {
+    return (outer * inner + FFTPlan::lanes - 1) / FFTPlan::lanes;
+}
+
+// Transforms a block of lines with the ortho normalization, src and dst may be the same.
+// Centered transforms apply ifftshift to the input and fftshift to the output.
+inline void transformLineBlock(const FFTPlan& plan, const float* src, float* dst, size_t outer, size_t inner,
+                               size_t block, bool inverse, bool centered) {
+    const size_t size = plan.size();
+    const size_t lanes = FFTPlan::lanes;
+    const size_t numLines = outer * inner;
+
+    // inverse transform is the conjugated forward transform of the conjugated signal
+    const float sign = inverse ? -1.0f : 1.0f;
+    const float scale = 1.0f / std::sqrt(static_cast<float>(size));
+    // the shifts are index remappings of the line elements
+    const size_t shift = centered ? size / 2 : 0;
+
+    thread_local std::vector<float> buffer;
+    buffer.resize(4 * size * lanes);
+    float* re = buffer.data();
+    float* im = re + size * lanes;
+    float* workRe = im + size * lanes;
+    float* workIm = workRe + size * lanes;
+
+    const size_t firstLine = block * lanes;
+    const size_t numLanes = std::min(lanes, numLines - firstLine);
+    size_t offsets[FFTPlan::lanes];
+    for (size_t l = 0; l < numLanes; ++l) {
+        const size_t line = firstLine + l;
+        offsets[l] = ((line / inner) * size * inner + line % inner) * 2;
+    }
+
+    std::fill(re, re + 2 * size * lanes, 0.0f);
+    for (size_t k = 0, pos = shift; k < size; ++k, pos = pos + 1 == size ? 0 : pos + 1) {
+        for (size_t l = 0; l < numLanes; ++l) {
+            const float* value = src + offsets[l] + pos * inner * 2;
+            re[k * lanes + l] = value[0];
+            im[k * lanes + l] = sign * value[1];
+        }
+    }
+
+    plan.transform(re, im, workRe, workIm);
+
+    for (size_t k = 0, pos = shift; k < size; ++k, pos = pos + 1 == size ? 0 : pos + 1) {
+        for (size_t l = 0; l < numLanes; ++l) {
+            float* value = dst + offsets[l] + pos * inner * 2;
+            value[0] = scale * re[k * lanes + l];
+            value[1] = sign * scale * im[k * lanes + l];
+        }
+    }
+}
+
+}  // namespace TemplateExtension
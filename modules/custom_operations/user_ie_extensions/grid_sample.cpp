@@ -3,15 +3,122 @@
 //
 
 #include "grid_sample.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
 #include <openvino/core/parallel.hpp>
 
 using namespace TemplateExtension;
 
-GridSample::GridSample(const ov::OutputVector& args) : Op(args) {
+namespace {
+
+enum class Mode { Bilinear, Nearest, Bicubic };
+enum class Padding { Zeros, Border, Reflection };
+
+// Maps a normalized grid coordinate in [-1, 1] to the input pixels
+float unnormalize(float coord, size_t size, bool alignCorners) {
+    return alignCorners ? 0.5f * (coord + 1) * (size - 1) : 0.5f * ((coord + 1) * size - 1);
+}
+
+float reflect(float coord, int64_t twiceLow, int64_t twiceHigh) {
+    if (twiceLow == twiceHigh)
+        return 0;
+    const float low = twiceLow / 2.0f;
+    const float span = (twiceHigh - twiceLow) / 2.0f;
+    coord = std::fabs(coord - low);
+    const float extra = std::fmod(coord, span);
+    const int64_t flips = static_cast<int64_t>(std::floor(coord / span));
+    return flips % 2 == 0 ? extra + low : span - extra + low;
+}
+
+// Moves a coordinate inside the input for border and reflection padding as torch does
+float pad(float coord, size_t size, Padding padding, bool alignCorners) {
+    if (padding == Padding::Zeros)
+        return coord;
+    if (padding == Padding::Reflection) {
+        const int64_t twiceSize = 2 * static_cast<int64_t>(size);
+        coord = alignCorners ? reflect(coord, 0, twiceSize - 2) : reflect(coord, -1, twiceSize - 1);
+    }
+    return std::min(static_cast<float>(size - 1), std::max(coord, 0.0f));
+}
+
+// Keeps far away and non-finite coordinates convertible to integers, such pixels are outside the input anyway
+int64_t toIndex(float coord) {
+    const float limit = 1 << 30;
+    return coord == coord ? static_cast<int64_t>(std::min(std::max(coord, -limit), limit)) : -(1 << 30);
+}
+
+// Cubic convolution coefficients of the taps -1, 0, 1, 2 with A = -0.75 as in torch
+void cubicCoefficients(float t, float coeffs[4]) {
+    const float A = -0.75f;
+    const float x1 = t + 1, x2 = 1 - t, x3 = 2 - t;
+    coeffs[0] = ((A * x1 - 5 * A) * x1 + 8 * A) * x1 - 4 * A;
+    coeffs[1] = ((A + 2) * t - (A + 3)) * t * t + 1;
+    coeffs[2] = ((A + 2) * x2 - (A + 3)) * x2 * x2 + 1;
+    coeffs[3] = ((A * x3 - 5 * A) * x3 + 8 * A) * x3 - 4 * A;
+}
+
+// Input pixels and weights of an output pixel. Pixels outside the input get index 0 and are masked out,
+// so sampling has no branches. The value is masked rather than multiplied by a zero weight,
+// as 0 * inf or 0 * NaN of the pixel 0 isn't 0.
+template <size_t taps>
+struct Taps {
+    uint32_t indices[taps];  // offsets in the input plane
+    float weights[taps];
+    bool inside[taps];
+
+    void set(size_t k, int64_t x, int64_t y, size_t width, size_t height, float weight) {
+        inside[k] = 0 <= x && x < static_cast<int64_t>(width) && 0 <= y && y < static_cast<int64_t>(height);
+        indices[k] = inside[k] ? static_cast<uint32_t>(y * width + x) : 0;
+        weights[k] = weight;
+    }
+};
+
+// Samples all channels of an output row with the taps computed once per output pixel.
+// Channels are processed by blocks, so the taps of a pixel are loaded once for all channels of a block.
+template <size_t taps>
+void sampleRow(const std::vector<Taps<taps> >& rowTaps, const float* inp, size_t inpPlane, float* out,
+               size_t outPlane, size_t channels) {
+    const size_t channelBlock = 16;
+    const size_t width = rowTaps.size();
+    for (size_t c0 = 0; c0 < channels; c0 += channelBlock) {
+        const size_t blockSize = std::min(channelBlock, channels - c0);
+        const float* planes = inp + c0 * inpPlane;
+        float* outRows = out + c0 * outPlane;
+        for (size_t x = 0; x < width; ++x) {
+            const Taps<taps>& pixel = rowTaps[x];
+            for (size_t c = 0; c < blockSize; ++c) {
+                const float* plane = planes + c * inpPlane;
+                float sum = 0.0f;
+                for (size_t k = 0; k < taps; ++k) {
+                    const float value = pixel.weights[k] * plane[pixel.indices[k]];
+                    sum += pixel.inside[k] ? value : 0.0f;
+                }
+                outRows[c * outPlane + x] = sum;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+GridSample::GridSample(const ov::OutputVector& args,
+                       const std::string& mode,
+                       const std::string& paddingMode,
+                       bool alignCorners)
+    : Op(args), mode(mode), paddingMode(paddingMode), alignCorners(alignCorners) {
     constructor_validate_and_infer_types();
 }
 
 void GridSample::validate_and_infer_types() {
+    OPENVINO_ASSERT(mode == "bilinear" || mode == "nearest" || mode == "bicubic",
+                    "GridSample got unsupported mode ", mode);
+    OPENVINO_ASSERT(paddingMode == "zeros" || paddingMode == "border" || paddingMode == "reflection",
+                    "GridSample got unsupported padding mode ", paddingMode);
+
     auto outShape = get_input_partial_shape(0);  // NC
     // Grid input has a shape NxHxWx2
     auto gridShape = get_input_partial_shape(1);
@@ -22,7 +129,16 @@ void GridSample::validate_and_infer_types() {
 
 std::shared_ptr<ov::Node> GridSample::clone_with_new_inputs(const ov::OutputVector& new_args) const {
     OPENVINO_ASSERT(new_args.size() == 2, "Incorrect number of new arguments");
-    return std::make_shared<GridSample>(new_args);
+    return std::make_shared<GridSample>(new_args, mode, paddingMode, alignCorners);
+}
+
+bool GridSample::visit_attributes(ov::AttributeVisitor& visitor) {
+    int align_corners_i = static_cast<int>(alignCorners);
+    visitor.on_attribute("mode", mode);
+    visitor.on_attribute("padding_mode", paddingMode);
+    visitor.on_attribute("align_corners", align_corners_i);
+    alignCorners = static_cast<bool>(align_corners_i);
+    return true;
 }
 
 bool GridSample::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
@@ -42,64 +158,67 @@ bool GridSample::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
     const size_t inpPlane  = inpHeight * inpWidth;
     const size_t outPlane  = height * width;
 
-    std::vector<float> zerosPlane(inpDims[1] * inpDims[2] * inpDims[3], 0);
-    float* zeros = zerosPlane.data();
+    OPENVINO_ASSERT(inpPlane <= std::numeric_limits<uint32_t>::max(), "GridSample input plane is too large: ",
+                    inputs[0].get_shape());
 
-    ov::parallel_for(batch, [&](size_t d) {
+    const Mode sampling = mode == "nearest" ? Mode::Nearest : mode == "bicubic" ? Mode::Bicubic : Mode::Bilinear;
+    const Padding padding = paddingMode == "border" ? Padding::Border :
+                            paddingMode == "reflection" ? Padding::Reflection : Padding::Zeros;
+    const bool align = alignCorners;
+
+    // every task is an output row of an image
+    ov::parallel_for(batch * height, [&](size_t task) {
+        const size_t d = task / height;
+        const size_t y = task % height;
         const float* inp  = inpData + d * channels * inpPlane;
-        const float* grid = gridData + d * outPlane * 2;
-        for (size_t y = 0; y < height; ++y) {
+        const float* grid = gridData + (d * outPlane + y * width) * 2;
+        float* out = outData + d * channels * outPlane + y * width;
+
+        if (sampling == Mode::Nearest) {
+            thread_local std::vector<Taps<1> > rowTaps;
+            rowTaps.resize(width);
             for (size_t x = 0; x < width; ++x) {
-                size_t offset = y * width + x;
-
-                float input_x = 0.5f * (grid[offset * 2] + 1) * (inpWidth - 1);
-                int x0 = static_cast<int>(std::floor(input_x));
-                int x1 = x0 + 1;
-
-                float input_y = 0.5f * (grid[offset * 2 + 1] + 1) * (inpHeight - 1);
-                int y0 = static_cast<int>(std::floor(input_y));
-                int y1 = y0 + 1;
-
-                const float* inp_row0 = (0 <= y0 && y0 < inpHeight) ? inp + y0 * inpWidth : zeros;
-                const float* inp_row1 = (0 <= y1 && y1 < inpHeight) ? inp + y1 * inpWidth : zeros;
-                float* out = outData + d * channels * outPlane;
-                if ((x1 < 0 || inpWidth <= x1) && (x0 < 0 || inpWidth <= x0)) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = 0;
-                        out += outPlane;
-                    }
-                }
-                else if (x1 < 0 || inpWidth <= x1) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x0] - inp_row0[x0]) +
-                            (input_x - x0) * (-inp_row0[x0] +
-                            (input_y - y0) * (inp_row0[x0] - inp_row1[x0]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
-                    }
-                }
-                else if (x0 < 0 || inpWidth <= x0) {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] =
-                            (input_x - x0) * (inp_row0[x1] + (input_y - y0) * (inp_row1[x1] - inp_row0[x1]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
-                    }
-                } else {
-                    for (size_t c = 0; c < channels; ++c) {
-                        out[offset] = inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x0] - inp_row0[x0]) +
-                            (input_x - x0) * (inp_row0[x1] - inp_row0[x0] +
-                            (input_y - y0) * (inp_row1[x1] - inp_row0[x1] - inp_row1[x0] + inp_row0[x0]));
-                        out += outPlane;
-                        inp_row0 += inpPlane;
-                        inp_row1 += inpPlane;
+                const float inputX = pad(unnormalize(grid[x * 2], inpWidth, align), inpWidth, padding, align);
+                const float inputY = pad(unnormalize(grid[x * 2 + 1], inpHeight, align), inpHeight, padding, align);
+                // rounds half to even as torch does
+                rowTaps[x].set(0, toIndex(std::nearbyint(inputX)), toIndex(std::nearbyint(inputY)),
+                               inpWidth, inpHeight, 1.0f);
+            }
+            sampleRow(rowTaps, inp, inpPlane, out, outPlane, channels);
+        } else if (sampling == Mode::Bicubic) {
+            thread_local std::vector<Taps<16> > rowTaps;
+            rowTaps.resize(width);
+            for (size_t x = 0; x < width; ++x) {
+                // padding is applied to every tap of bicubic interpolation
+                const float inputX = unnormalize(grid[x * 2], inpWidth, align);
+                const float inputY = unnormalize(grid[x * 2 + 1], inpHeight, align);
+                const float floorX = std::floor(inputX), floorY = std::floor(inputY);
+                float coeffsX[4], coeffsY[4];
+                cubicCoefficients(inputX - floorX, coeffsX);
+                cubicCoefficients(inputY - floorY, coeffsY);
+                for (int i = 0; i < 4; ++i) {
+                    const int64_t tapY = toIndex(pad(floorY + i - 1, inpHeight, padding, align));
+                    for (int j = 0; j < 4; ++j) {
+                        const int64_t tapX = toIndex(pad(floorX + j - 1, inpWidth, padding, align));
+                        rowTaps[x].set(i * 4 + j, tapX, tapY, inpWidth, inpHeight, coeffsY[i] * coeffsX[j]);
                     }
                 }
             }
+            sampleRow(rowTaps, inp, inpPlane, out, outPlane, channels);
+        } else {
+            thread_local std::vector<Taps<4> > rowTaps;
+            rowTaps.resize(width);
+            for (size_t x = 0; x < width; ++x) {
+                const float inputX = pad(unnormalize(grid[x * 2], inpWidth, align), inpWidth, padding, align);
+                const float inputY = pad(unnormalize(grid[x * 2 + 1], inpHeight, align), inpHeight, padding, align);
+                const int64_t x0 = toIndex(std::floor(inputX)), y0 = toIndex(std::floor(inputY));
+                const float dx = inputX - x0, dy = inputY - y0;
+                rowTaps[x].set(0, x0, y0, inpWidth, inpHeight, (1 - dx) * (1 - dy));
+                rowTaps[x].set(1, x0 + 1, y0, inpWidth, inpHeight, dx * (1 - dy));
+                rowTaps[x].set(2, x0, y0 + 1, inpWidth, inpHeight, (1 - dx) * dy);
+                rowTaps[x].set(3, x0 + 1, y0 + 1, inpWidth, inpHeight, dx * dy);
+            }
+            sampleRow(rowTaps, inp, inpPlane, out, outPlane, channels);
         }
     });
     return true;
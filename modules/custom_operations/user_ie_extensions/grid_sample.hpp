@@ -13,12 +13,22 @@ public:
     OPENVINO_OP("GridSample");
 
     GridSample() = default;
-    GridSample(const ov::OutputVector& new_args);
+    GridSample(const ov::OutputVector& new_args,
+               const std::string& mode = "bilinear",
+               const std::string& paddingMode = "zeros",
+               bool alignCorners = true);
     void validate_and_infer_types() override;
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
     bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
     bool has_evaluate() const override;
+
+private:
+    // the same as in torch.nn.functional.grid_sample
+    std::string mode = "bilinear";       // bilinear, nearest or bicubic
+    std::string paddingMode = "zeros";   // zeros, border or reflection
+    bool alignCorners = true;
 };
 
 }  // namespace TemplateExtension
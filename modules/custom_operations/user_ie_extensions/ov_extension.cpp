@@ -16,6 +16,16 @@
 #    define CALCULATE_GRID_EXT
 #endif
 
+#ifdef grid_sample
+#    include "grid_sample.hpp"
+// the frontend name differs from the ONNX GridSample to not take its translation over, the defaults don't match
+#    define GRID_SAMPLE_EXT                                                                            \
+            std::make_shared<ov::OpExtension<TemplateExtension::GridSample>>(),                        \
+            std::make_shared<ov::frontend::OpExtension<TemplateExtension::GridSample>>("CustomGridSample"),
+#else
+#    define GRID_SAMPLE_EXT
+#endif
+
 #ifdef complex_mul
 #    include "complex_mul.hpp"
 #    define COMPLEX_MUL_EXT                                                                            \
@@ -34,6 +44,16 @@
 #    define FFT_EXT
 #endif
 
+#ifdef fft_filter
+#    include "fft_filter.hpp"
+#    define FFT_FILTER_EXT                                                                             \
+            std::make_shared<ov::OpExtension<TemplateExtension::FFTFilter>>(),                         \
+            std::make_shared<ov::frontend::OpExtension<TemplateExtension::FFTFilter>>(),               \
+            std::make_shared<ov::frontend::DecoderTransformationExtension>(TemplateExtension::fuseFFTFilter),
+#else
+#    define FFT_FILTER_EXT
+#endif
+
 #ifdef sparse_conv_transpose
 #    include "sparse_conv_transpose.hpp"
 #    define S_CONV_TRANSPOSE_EXT                                                                      \
@@ -75,6 +95,7 @@
             std::make_shared<ov::OpExtension<RaggedToDense>>(),                                                             \
             std::make_shared<ov::OpExtension<VocabDecoder>>(),                                                             \
             std::make_shared<ov::OpExtension<CharsToBytes>>(),                                                             \
+            std::make_shared<ov::OpExtension<UTF8StreamBuffer>>(),                                                         \
             std::make_shared<ov::frontend::ConversionExtension>("Reshape", translate_reshape),                              \
             std::make_shared<ov::frontend::ConversionExtension>("Const", translate_const),                                  \
             std::make_shared<ov::OpExtension<TemplateExtension::SentencepieceTokenizer>>(),                                 \
@@ -89,7 +110,9 @@
 OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>(
     {
         CALCULATE_GRID_EXT
+        GRID_SAMPLE_EXT
         FFT_EXT
+        FFT_FILTER_EXT
         S_CONV_TRANSPOSE_EXT
         S_CONV_EXT
         COMPLEX_MUL_EXT
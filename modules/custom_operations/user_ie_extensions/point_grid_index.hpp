@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace TemplateExtension {
+
+// Buckets 3D points by the cells of a regular grid to find the points inside a box without testing every point.
+// Points are sorted by their cell coordinates, so the points of a row of cells along Z lie contiguously
+// and are found by a binary search. With cells of half the box size a query visits about 3x3 rows of cells.
+class PointGridIndex {
+public:
+    PointGridIndex(const float* positions, size_t numPoints, const float cellSize[3]) : m_cells(numPoints) {
+        for (int axis = 0; axis < 3; ++axis) {
+            m_cellSize[axis] = cellSize[axis];
+        }
+        for (size_t i = 0; i < numPoints; ++i) {
+            m_cells[i] = {cellCoord(positions[i * 3], 0),
+                          cellCoord(positions[i * 3 + 1], 1),
+                          cellCoord(positions[i * 3 + 2], 2),
+                          i};
+        }
+        // points of the same cell stay in the order of their indices
+        std::sort(m_cells.begin(), m_cells.end(), [](const Cell& lhs, const Cell& rhs) {
+            return cellLess(lhs, rhs) || (!cellLess(rhs, lhs) && lhs.point < rhs.point);
+        });
+    }
+
+    // Collects indices of the points which may lie inside the box [lo, hi] grouped by cells, in a deterministic order.
+    // The result is a superset of the points inside the box, the caller applies the exact test.
+    void findCandidates(const float lo[3], const float hi[3], std::vector<size_t>& candidates) const {
+        candidates.clear();
+        const int64_t x0 = cellCoord(lo[0], 0), x1 = cellCoord(hi[0], 0);
+        const int64_t y0 = cellCoord(lo[1], 1), y1 = cellCoord(hi[1], 1);
+        const int64_t z0 = cellCoord(lo[2], 2), z1 = cellCoord(hi[2], 2);
+
+        for (int64_t x = x0; x <= x1; ++x) {
+            for (int64_t y = y0; y <= y1; ++y) {
+                const Cell first = {x, y, z0, 0};
+                const Cell last = {x, y, z1, 0};
+                auto begin = std::lower_bound(m_cells.begin(), m_cells.end(), first, cellLess);
+                auto end = std::upper_bound(begin, m_cells.end(), last, cellLess);
+                for (auto it = begin; it != end; ++it) {
+                    candidates.push_back(it->point);
+                }
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        int64_t x, y, z;
+        size_t point;
+    };
+
+    static bool cellLess(const Cell& lhs, const Cell& rhs) {
+        return lhs.x != rhs.x ? lhs.x < rhs.x : lhs.y != rhs.y ? lhs.y < rhs.y : lhs.z < rhs.z;
+    }
+
+    // Division and floor are monotonic, so a point inside the box always gets a cell between the cells of the box corners
+    int64_t cellCoord(float value, int axis) const {
+        const float limit = 1e15f;  // keeps the conversion defined for far away points
+        return static_cast<int64_t>(std::floor(std::min(std::max(value / m_cellSize[axis], -limit), limit)));
+    }
+
+    float m_cellSize[3];
+    std::vector<Cell> m_cells;
+};
+
+}  // namespace TemplateExtension
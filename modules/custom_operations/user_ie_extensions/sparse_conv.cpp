@@ -3,6 +3,7 @@
 //
 
 #include "sparse_conv.hpp"
+#include "sparse_conv_rulebook.hpp"
 
 using namespace TemplateExtension;
 
@@ -42,11 +43,6 @@ bool SparseConv::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
     const int IC = static_cast<int>(kernelDims[3]);
     const int OC = static_cast<int>(kernelDims[4]);
 
-    // See https://github.com/isl-org/Open3D/blob/master/python/open3d/ml/torch/python/layers/convolutions.py
-    float rw = kw * 0.51f;
-    float rh = kh * 0.51f;
-    float rd = kd * 0.51f;
-
     for (size_t i = 0; i < numInpPoints; ++i) {
         if (inpPos[i * 3] < 0) {
             numInpPoints = i;
@@ -54,35 +50,8 @@ bool SparseConv::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
         }
     }
 
-    for (size_t i = 0; i < numOutPoints; ++i) {
-        const float xi = outPos[i * 3] - offset[0];
-        const float yi = outPos[i * 3 + 1] - offset[1];
-        const float zi = outPos[i * 3 + 2] - offset[2];
-
-        // Accumulate features which inside the kernel
-        for (size_t j = 0; j < numInpPoints; ++j) {
-            const float xj = inpPos[j * 3];
-            const float yj = inpPos[j * 3 + 1];
-            const float zj = inpPos[j * 3 + 2];
-
-            if (xi - rw <= xj && xj <= xi + rw &&
-                yi - rh <= yj && yj <= yi + rh &&
-                zi - rd <= zj && zj <= zi + rd) {
-
-                const int w = std::min(static_cast<int>(xj - xi + kw * 0.5f), kw - 1);
-                const int h = std::min(static_cast<int>(yj - yi + kh * 0.5f), kh - 1);
-                const int d = std::min(static_cast<int>(zj - zi + kd * 0.5f), kd - 1);
-
-                const float* featuresOffset = features + j * IC;
-                for (int ic = 0; ic < IC; ++ic) {
-                    const float* kernelOffset = kernel + OC * (ic + IC * (w + kw * (h + kh * d)));
-                    for (int oc = 0; oc < OC; ++oc) {
-                        out[i * OC + oc] += kernelOffset[oc] * featuresOffset[ic];
-                    }
-                }
-            }
-        }
-    }
+    const SparseConvRulebook rulebook(inpPos, numInpPoints, outPos, numOutPoints, offset, kd, kh, kw, false);
+    rulebook.apply(features, kernel, IC, OC, out);
     return true;
 }
 
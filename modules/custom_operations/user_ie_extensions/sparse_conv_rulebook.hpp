@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <openvino/core/parallel.hpp>
+
+#include "point_grid_index.hpp"
+
+namespace TemplateExtension {
+
+// Sparse convolution split into rulebooks: for every kernel offset the list of (input point, output point) pairs
+// that use it. Each kernel offset is then a gathered GEMM of the input features of its pairs by the IC x OC weights
+// of the offset, scattered-added to the output features, as in MinkowskiEngine and Open3D.
+// The weights of an offset stay in cache while its pairs are processed in blocks, and every block updates
+// the output rows once instead of once per input channel.
+class SparseConvRulebook {
+public:
+    // Kernel offsets are flipped for transposed convolution
+    SparseConvRulebook(const float* inpPos, size_t numInpPoints, const float* outPos, size_t numOutPoints,
+                       const float offset[3], int kd, int kh, int kw, bool transpose)
+        : m_kd(kd), m_kh(kh), m_kw(kw), m_transpose(transpose) {
+        // See https://github.com/isl-org/Open3D/blob/master/python/open3d/ml/torch/python/layers/convolutions.py
+        m_radius[0] = kw * 0.51f;
+        m_radius[1] = kh * 0.51f;
+        m_radius[2] = kd * 0.51f;
+
+        // Input points are bucketed by cells of half the kernel box size, so every output point tests only nearby points
+        const float cellSize[] = {m_radius[0], m_radius[1], m_radius[2]};
+        const PointGridIndex index(inpPos, numInpPoints, cellSize);
+
+        // First pass: the number of pairs of every output point, second pass: the pairs at the known offsets
+        std::vector<size_t> outputBegins(numOutPoints + 1, 0);
+        ov::parallel_for(numOutPoints, [&](size_t i) {
+            size_t numPairs = 0;
+            forEachNeighbour(index, inpPos, outPos, offset, i, [&](size_t, size_t) {
+                ++numPairs;
+            });
+            outputBegins[i + 1] = numPairs;
+        });
+        for (size_t i = 0; i < numOutPoints; ++i) {
+            outputBegins[i + 1] += outputBegins[i];
+        }
+
+        std::vector<Pair> pairsByOutput(outputBegins[numOutPoints]);
+        std::vector<size_t> pairOffsets(pairsByOutput.size());
+        ov::parallel_for(numOutPoints, [&](size_t i) {
+            size_t pos = outputBegins[i];
+            forEachNeighbour(index, inpPos, outPos, offset, i, [&](size_t j, size_t kernelOffset) {
+                pairsByOutput[pos] = {j, i};
+                pairOffsets[pos++] = kernelOffset;
+            });
+        });
+
+        // Counting sort by kernel offsets keeps the pairs of an offset ordered by output points
+        const size_t numOffsets = static_cast<size_t>(kd) * kh * kw;
+        std::vector<size_t> offsetBegins(numOffsets + 1, 0);
+        for (size_t kernelOffset : pairOffsets) {
+            ++offsetBegins[kernelOffset + 1];
+        }
+        for (size_t k = 0; k < numOffsets; ++k) {
+            offsetBegins[k + 1] += offsetBegins[k];
+        }
+        m_pairs.resize(pairsByOutput.size());
+        std::vector<size_t> positions(offsetBegins.begin(), offsetBegins.end() - 1);
+        for (size_t p = 0; p < pairsByOutput.size(); ++p) {
+            m_pairs[positions[pairOffsets[p]]++] = pairsByOutput[p];
+        }
+
+        // Chunks of an offset are processed in parallel, so pairs of one output point never go to different chunks.
+        // Chunk bounds don't depend on the number of threads to keep results reproducible.
+        m_offsetFirstChunk.assign(numOffsets + 1, 0);
+        for (size_t k = 0; k < numOffsets; ++k) {
+            m_offsetFirstChunk[k] = m_chunkBegins.size();
+            for (size_t p = offsetBegins[k]; p < offsetBegins[k + 1];) {
+                m_chunkBegins.push_back(p);
+                size_t next = std::min(p + pairsPerChunk, offsetBegins[k + 1]);
+                while (next < offsetBegins[k + 1] && m_pairs[next].output == m_pairs[next - 1].output) {
+                    ++next;
+                }
+                p = next;
+            }
+        }
+        m_offsetFirstChunk[numOffsets] = m_chunkBegins.size();
+        m_chunkBegins.push_back(m_pairs.size());
+    }
+
+    // Accumulates the convolution of features with the DxHxWxICxOC kernel to out
+    void apply(const float* features, const float* kernel, int IC, int OC, float* out) const {
+        const size_t numOffsets = m_offsetFirstChunk.size() - 1;
+        for (size_t k = 0; k < numOffsets; ++k) {
+            const size_t firstChunk = m_offsetFirstChunk[k];
+            const size_t numChunks = m_offsetFirstChunk[k + 1] - firstChunk;
+            const float* weights = kernel + k * IC * OC;
+            ov::parallel_for(numChunks, [&](size_t chunk) {
+                applyChunk(m_chunkBegins[firstChunk + chunk], m_chunkBegins[firstChunk + chunk + 1],
+                           features, weights, IC, OC, out);
+            });
+        }
+    }
+
+private:
+    struct Pair {
+        size_t input;
+        size_t output;
+    };
+
+    static const size_t pairsPerChunk = 256;
+    static const size_t pairsPerBlock = 8;
+
+    // Calls f(input point, kernel offset) for every input point inside the kernel box of the output point
+    template <typename F>
+    void forEachNeighbour(const PointGridIndex& index, const float* inpPos, const float* outPos,
+                          const float offset[3], size_t i, F f) const {
+        const float xi = outPos[i * 3] - offset[0];
+        const float yi = outPos[i * 3 + 1] - offset[1];
+        const float zi = outPos[i * 3 + 2] - offset[2];
+        const float rw = m_radius[0], rh = m_radius[1], rd = m_radius[2];
+
+        thread_local std::vector<size_t> candidates;
+        const float lo[] = {xi - rw, yi - rh, zi - rd};
+        const float hi[] = {xi + rw, yi + rh, zi + rd};
+        index.findCandidates(lo, hi, candidates);
+
+        for (size_t j : candidates) {
+            const float xj = inpPos[j * 3];
+            const float yj = inpPos[j * 3 + 1];
+            const float zj = inpPos[j * 3 + 2];
+
+            if (xi - rw <= xj && xj <= xi + rw &&
+                yi - rh <= yj && yj <= yi + rh &&
+                zi - rd <= zj && zj <= zi + rd) {
+
+                int w = std::min(static_cast<int>(xj - xi + m_kw * 0.5f), m_kw - 1);
+                int h = std::min(static_cast<int>(yj - yi + m_kh * 0.5f), m_kh - 1);
+                int d = std::min(static_cast<int>(zj - zi + m_kd * 0.5f), m_kd - 1);
+                if (m_transpose) {
+                    w = m_kw - 1 - w;
+                    h = m_kh - 1 - h;
+                    d = m_kd - 1 - d;
+                }
+                f(j, static_cast<size_t>(w + m_kw * (h + m_kh * d)));
+            }
+        }
+    }
+
+    // Multiplies gathered input features of a block of pairs by the IC x OC weights and adds the result to the outputs
+    void applyChunk(size_t begin, size_t end, const float* features, const float* weights, int IC, int OC,
+                    float* out) const {
+        thread_local std::vector<float> block;
+        block.resize(pairsPerBlock * OC);
+
+        for (size_t p = begin; p < end; p += pairsPerBlock) {
+            const size_t numPairs = std::min(end - p, size_t(pairsPerBlock));
+            std::fill(block.begin(), block.begin() + numPairs * OC, 0.0f);
+
+            for (int ic = 0; ic < IC; ++ic) {
+                const float* weightsRow = weights + ic * OC;
+                for (size_t r = 0; r < numPairs; ++r) {
+                    const float feature = features[m_pairs[p + r].input * IC + ic];
+                    float* blockRow = block.data() + r * OC;
+                    for (int oc = 0; oc < OC; ++oc) {
+                        blockRow[oc] += feature * weightsRow[oc];
+                    }
+                }
+            }
+
+            // pairs of a block may share an output point, so they are added one by one
+            for (size_t r = 0; r < numPairs; ++r) {
+                float* outRow = out + m_pairs[p + r].output * OC;
+                const float* blockRow = block.data() + r * OC;
+                for (int oc = 0; oc < OC; ++oc) {
+                    outRow[oc] += blockRow[oc];
+                }
+            }
+        }
+    }
+
+    int m_kd, m_kh, m_kw;
+    bool m_transpose;
+    float m_radius[3];
+
+    std::vector<Pair> m_pairs;              // ordered by kernel offsets, then by output points
+    std::vector<size_t> m_chunkBegins;      // the last element is the number of pairs
+    std::vector<size_t> m_offsetFirstChunk; // chunks of kernel offset k are [m_offsetFirstChunk[k], m_offsetFirstChunk[k + 1])
+};
+
+}  // namespace TemplateExtension
@@ -0,0 +1,286 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdio>
+
+#include "bpe_model.hpp"
+#include "utils.hpp"
+
+using namespace ov;
+using op::v0::Constant;
+
+namespace {
+
+constexpr uint64_t empty_pair = ~uint64_t(0);   // token ids are non-negative, so a real pair never has this value
+
+struct Symbol {
+    int32_t id;
+    int32_t prev;
+    int32_t next;
+    bool removed;
+};
+
+struct Merge {
+    int32_t rank;
+    int32_t pos;
+    int32_t new_id;
+};
+
+// std heap functions build a max-heap, so put the lowest rank and the leftmost position on top
+struct MergeOrder {
+    bool operator()(const Merge& lhs, const Merge& rhs) const {
+        return lhs.rank != rhs.rank ? lhs.rank > rhs.rank : lhs.pos > rhs.pos;
+    }
+};
+
+size_t table_size_for(size_t num_elements) {
+    size_t size = 16;
+    while (size < 2 * num_elements) {
+        size <<= 1;
+    }
+    return size;
+}
+
+uint64_t make_pair_key(int32_t left_id, int32_t right_id) {
+    return (uint64_t(uint32_t(left_id)) << 32) | uint32_t(right_id);
+}
+
+uint64_t hash_pair_key(uint64_t key) {
+    // finalizer from MurmurHash3
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+}  // namespace
+
+
+BPEModel::BPEModel(
+    const std::shared_ptr<Constant>& packed_vocab,
+    const std::shared_ptr<Constant>& packed_merges,
+    const std::string& unk_token,
+    bool fuse_unk,
+    const std::string& suffix_indicator,
+    const std::string& end_suffix,
+    bool byte_fallback
+) :
+    m_packed_vocab(packed_vocab),
+    m_fuse_unk(fuse_unk),
+    m_suffix_indicator(suffix_indicator),
+    m_end_suffix(end_suffix),
+    m_byte_fallback(byte_fallback) {
+    OPENVINO_ASSERT(packed_vocab && packed_merges, "BPEModel expects vocab and merges to be packed string constants");
+
+    auto packed_vocab_buf = static_cast<const char*>(m_packed_vocab->get_data_ptr());
+    auto vocab_size = *reinterpret_cast<const int32_t*>(packed_vocab_buf + 0);
+    m_vocab_offsets = reinterpret_cast<const int32_t*>(packed_vocab_buf + 4);
+    m_vocab_chars = packed_vocab_buf + 4 + 4 + 4 * vocab_size;
+
+    m_vocab_table.assign(table_size_for(vocab_size), -1);
+    m_vocab_mask = m_vocab_table.size() - 1;
+    for (int32_t id = 0; id < vocab_size; ++id) {
+        const auto token = id_to_token(id);
+        auto slot = std::hash<std::string_view>{}(token) & m_vocab_mask;
+        while (m_vocab_table[slot] != -1 && id_to_token(m_vocab_table[slot]) != token) {
+            slot = (slot + 1) & m_vocab_mask;
+        }
+        // the last duplicated token wins as it was in the map-based vocab
+        m_vocab_table[slot] = id;
+    }
+
+    if (!unk_token.empty()) {
+        m_unk_id = token_to_id(unk_token);
+    }
+
+    char byte_token[7];
+    for (size_t byte = 0; byte < m_byte_ids.size(); ++byte) {
+        std::snprintf(byte_token, sizeof(byte_token), "<0x%02X>", static_cast<unsigned>(byte));
+        m_byte_ids[byte] = token_to_id(byte_token);
+    }
+
+    auto packed_merges_buf = static_cast<const char*>(packed_merges->get_data_ptr());
+    auto merges_size = *reinterpret_cast<const int32_t*>(packed_merges_buf + 0);
+    auto merges_offsets = reinterpret_cast<const int32_t*>(packed_merges_buf + 4);
+    auto merges_chars = packed_merges_buf + 4 + 4 + 4 * merges_size;
+
+    m_merges_table.assign(table_size_for(merges_size), {empty_pair, 0, 0});
+    m_merges_mask = m_merges_table.size() - 1;
+
+    std::string merged;  // reused for all merges
+    for (int32_t rank = 0; rank < merges_size; ++rank) {
+        const auto merge = std::string_view(merges_chars + merges_offsets[rank], merges_offsets[rank + 1] - merges_offsets[rank]);
+        const auto delim_pos = merge.find(' ');
+        if (delim_pos == std::string_view::npos) {
+            continue;
+        }
+        const auto left = merge.substr(0, delim_pos);
+        const auto right = merge.substr(delim_pos + 1);
+        // the right part of the merge carries the suffix indicator that disappears in the merged token
+        const auto prefix_len = std::min(m_suffix_indicator.size(), right.size());
+
+        merged.assign(left.data(), left.size());
+        merged.append(right.data() + prefix_len, right.size() - prefix_len);
+
+        const auto left_id = token_to_id(left);
+        const auto right_id = token_to_id(right);
+        const auto new_id = token_to_id(merged);
+        if (left_id < 0 || right_id < 0 || new_id < 0) {
+            continue;   // merges with tokens out of the vocab can never be applied
+        }
+        add_merge(left_id, right_id, rank, new_id);
+    }
+}
+
+int32_t BPEModel::token_to_id(std::string_view token) const {
+    auto slot = std::hash<std::string_view>{}(token) & m_vocab_mask;
+    while (m_vocab_table[slot] != -1) {
+        if (id_to_token(m_vocab_table[slot]) == token) {
+            return m_vocab_table[slot];
+        }
+        slot = (slot + 1) & m_vocab_mask;
+    }
+    return -1;
+}
+
+void BPEModel::add_merge(int32_t left_id, int32_t right_id, int32_t rank, int32_t new_id) {
+    const auto pair = make_pair_key(left_id, right_id);
+    auto slot = hash_pair_key(pair) & m_merges_mask;
+    while (m_merges_table[slot].pair != empty_pair && m_merges_table[slot].pair != pair) {
+        slot = (slot + 1) & m_merges_mask;
+    }
+    m_merges_table[slot] = {pair, rank, new_id};
+}
+
+const BPEModel::MergeEntry* BPEModel::find_merge(int32_t left_id, int32_t right_id) const {
+    const auto pair = make_pair_key(left_id, right_id);
+    auto slot = hash_pair_key(pair) & m_merges_mask;
+    while (m_merges_table[slot].pair != empty_pair) {
+        if (m_merges_table[slot].pair == pair) {
+            return &m_merges_table[slot];
+        }
+        slot = (slot + 1) & m_merges_mask;
+    }
+    return nullptr;
+}
+
+void BPEModel::tokenize(std::string_view word, std::vector<int32_t>& token_ids) const {
+    // per-thread buffers don't allocate once they have grown to the longest word
+    thread_local std::vector<Symbol> symbols;
+    thread_local std::vector<Merge> queue;
+    thread_local std::string piece;
+    symbols.clear();
+    queue.clear();
+
+    auto add_symbol = [](int32_t id) {
+        const auto pos = static_cast<int32_t>(symbols.size());
+        symbols.push_back({id, pos - 1, pos + 1, false});
+    };
+
+    // Split the word into characters, each of them is expected to be in the vocab
+    bool pending_unk = false;
+    for (size_t i = 0; i < word.size();) {
+        const auto char_len = std::min(utf8_char_length(word[i]), word.size() - i);
+        const bool is_first = i == 0;
+        const bool is_last = i + char_len == word.size();
+        auto symbol = word.substr(i, char_len);
+        i += char_len;
+
+        const bool add_prefix = !is_first && !m_suffix_indicator.empty();
+        const bool add_suffix = is_last && !m_end_suffix.empty();
+        if (add_prefix || add_suffix) {
+            piece.clear();
+            if (add_prefix) piece += m_suffix_indicator;
+            piece.append(symbol.data(), symbol.size());
+            if (add_suffix) piece += m_end_suffix;
+            symbol = piece;
+        }
+
+        const auto id = token_to_id(symbol);
+        if (id >= 0) {
+            if (pending_unk) {
+                add_symbol(m_unk_id);
+                pending_unk = false;
+            }
+            add_symbol(id);
+            continue;
+        }
+
+        if (m_byte_fallback &&
+            std::all_of(symbol.begin(), symbol.end(), [this](char byte) { return m_byte_ids[uint8_t(byte)] >= 0; })) {
+            for (auto byte : symbol) {
+                add_symbol(m_byte_ids[uint8_t(byte)]);
+            }
+            continue;
+        }
+
+        if (m_unk_id >= 0) {
+            if (pending_unk && !m_fuse_unk) {
+                add_symbol(m_unk_id);
+            }
+            pending_unk = true;
+        }
+    }
+    if (pending_unk) {
+        add_symbol(m_unk_id);
+    }
+    if (symbols.empty()) {
+        return;
+    }
+    symbols.back().next = -1;
+
+    const auto num_symbols = static_cast<int32_t>(symbols.size());
+    for (int32_t pos = 0; pos + 1 < num_symbols; ++pos) {
+        if (auto merge = find_merge(symbols[pos].id, symbols[pos + 1].id)) {
+            queue.push_back({merge->rank, pos, merge->new_id});
+        }
+    }
+    std::make_heap(queue.begin(), queue.end(), MergeOrder{});
+
+    while (!queue.empty()) {
+        std::pop_heap(queue.begin(), queue.end(), MergeOrder{});
+        const auto top = queue.back();
+        queue.pop_back();
+
+        auto& current = symbols[top.pos];
+        if (current.removed || current.next < 0) {
+            continue;
+        }
+        auto& right = symbols[current.next];
+        // skip queue entries that became stale after previous merges
+        const auto merge = find_merge(current.id, right.id);
+        if (merge == nullptr || merge->new_id != top.new_id) {
+            continue;
+        }
+
+        current.id = top.new_id;
+        current.next = right.next;
+        right.removed = true;
+        if (current.next >= 0) {
+            symbols[current.next].prev = top.pos;
+        }
+
+        if (current.prev >= 0) {
+            if (auto prev_merge = find_merge(symbols[current.prev].id, current.id)) {
+                queue.push_back({prev_merge->rank, current.prev, prev_merge->new_id});
+                std::push_heap(queue.begin(), queue.end(), MergeOrder{});
+            }
+        }
+        if (current.next >= 0) {
+            if (auto next_merge = find_merge(current.id, symbols[current.next].id)) {
+                queue.push_back({next_merge->rank, top.pos, next_merge->new_id});
+                std::push_heap(queue.begin(), queue.end(), MergeOrder{});
+            }
+        }
+    }
+
+    for (const auto& symbol : symbols) {
+        if (!symbol.removed) {
+            token_ids.push_back(symbol.id);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <openvino/op/constant.hpp>
+
+// Byte-pair encoding model that works directly on the packed vocab and merges string constants.
+// Vocab tokens are not copied: the model keeps the vocab constant alive and looks tokens up in a flat
+// open-addressing table of token ids. Merges are kept as ranks in another flat table keyed by a pair of token ids.
+// A word is merged with a priority queue over a linked list of its symbols in O(n log n), buffers are reused
+// between words of the same thread. The behaviour follows the HuggingFace BPE model.
+class BPEModel {
+public:
+    BPEModel(
+        const std::shared_ptr<ov::op::v0::Constant>& packed_vocab,
+        const std::shared_ptr<ov::op::v0::Constant>& packed_merges,
+        const std::string& unk_token = "",
+        bool fuse_unk = false,
+        const std::string& suffix_indicator = "",
+        const std::string& end_suffix = "",
+        bool byte_fallback = false
+    );
+
+    // Appends ids of the word tokens to token_ids
+    void tokenize(std::string_view word, std::vector<int32_t>& token_ids) const;
+
+    // Returns id of the token or -1 if the vocab doesn't contain it
+    int32_t token_to_id(std::string_view token) const;
+
+private:
+    struct MergeEntry {
+        uint64_t pair;
+        int32_t rank;
+        int32_t new_id;
+    };
+
+    std::string_view id_to_token(int32_t id) const {
+        return std::string_view(m_vocab_chars + m_vocab_offsets[id], m_vocab_offsets[id + 1] - m_vocab_offsets[id]);
+    }
+
+    void add_merge(int32_t left_id, int32_t right_id, int32_t rank, int32_t new_id);
+    const MergeEntry* find_merge(int32_t left_id, int32_t right_id) const;
+
+    std::shared_ptr<ov::op::v0::Constant> m_packed_vocab;
+    const int32_t* m_vocab_offsets = nullptr;
+    const char* m_vocab_chars = nullptr;
+
+    std::vector<int32_t> m_vocab_table;     // token ids, -1 for empty slots
+    std::vector<MergeEntry> m_merges_table;
+    size_t m_vocab_mask = 0;
+    size_t m_merges_mask = 0;
+
+    int32_t m_unk_id = -1;
+    bool m_fuse_unk = false;
+    std::string m_suffix_indicator;
+    std::string m_end_suffix;
+    bool m_byte_fallback = false;
+    std::array<int32_t, 256> m_byte_ids;    // ids of <0xXX> tokens used for byte fallback, -1 if there is no token
+};
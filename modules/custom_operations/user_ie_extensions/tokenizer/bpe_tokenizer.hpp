@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <openvino/core/runtime_attribute.hpp>
 #include <openvino/op/op.hpp>
 
 #ifdef _MSC_VER
@@ -11,13 +12,40 @@
 #    pragma warning(disable : 4275)
 #endif
 
-#include "fast_tokenizer/models/models.h"
-
-using namespace paddlenlp::fast_tokenizer;
+#include "bpe_model.hpp"
+#include "token_cache.hpp"
 
 #undef tokenizer
 #undef m_tokenizer
 
+// Runtime info of BPETokenizer with the current statistics of its word cache, get_rt_info()[TokenCacheStatistics::get_type_info_static()]
+// prints them as "size=<words> hits=<lookups> misses=<lookups>". The values change with every inference,
+// so the attribute is not serialized and is not a part of the model hash.
+class TokenCacheStatistics : public ov::RuntimeAttribute {
+public:
+    OPENVINO_RTTI("token_cache_statistics", "0");
+
+    TokenCacheStatistics() = default;
+    explicit TokenCacheStatistics(const std::shared_ptr<const TokenCache>& cache) : m_cache(cache) {}
+
+    bool is_deterministic() const override {
+        return false;
+    }
+
+    std::string to_string() const override {
+        const auto cache = m_cache.lock();
+        if (!cache) {
+            return "size=0 hits=0 misses=0";
+        }
+        return "size=" + std::to_string(cache->get_size()) +
+               " hits=" + std::to_string(cache->get_hits()) +
+               " misses=" + std::to_string(cache->get_misses());
+    }
+
+private:
+    std::weak_ptr<const TokenCache> m_cache;
+};
+
 class BPETokenizer : public ov::op::Op {
 public:
     OPENVINO_OP("BPETokenizer");
@@ -29,22 +57,25 @@ public:
         bool fuse_unk = false,
         const std::string& suffix_indicator = "",
         const std::string& end_suffix = "",
-        bool byte_fallback = false
+        bool byte_fallback = false,
+        int cache_capacity = 20000
     );
     BPETokenizer(
         const ov::OutputVector& arguments,
-        const std::shared_ptr<models::BPE>& tokenizer,
+        const std::shared_ptr<BPEModel>& tokenizer,
+        const std::shared_ptr<TokenCache>& cache,
         const std::string& unk_token = "",
         bool fuse_unk = false,
         const std::string& suffix_indicator = "",
         const std::string& end_suffix = "",
-        bool byte_fallback = false
+        bool byte_fallback = false,
+        int cache_capacity = 20000
     );
 
     void validate_and_infer_types() override;
 
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
-        return std::make_shared<BPETokenizer>(inputs, m_tokenizer, m_unk_token, m_fuse_unk, m_suffix_indicator, m_end_suffix, m_byte_fallback);
+        return std::make_shared<BPETokenizer>(inputs, m_tokenizer, m_cache, m_unk_token, m_fuse_unk, m_suffix_indicator, m_end_suffix, m_byte_fallback, m_cache_capacity);
     }
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override {
@@ -53,6 +84,7 @@ public:
         visitor.on_attribute("suffix_indicator", m_suffix_indicator);
         visitor.on_attribute("end_suffix", m_end_suffix);
         visitor.on_attribute("byte_fallback", m_byte_fallback);
+        visitor.on_attribute("cache_capacity", m_cache_capacity);
         return true;
     }
 
@@ -62,11 +94,18 @@ public:
         return true;
     }
 
+    // Word cache shared between all clones of the node, nullptr if caching is disabled with zero cache_capacity
+    std::shared_ptr<const TokenCache> get_cache() const {
+        return m_cache;
+    }
+
 private:
-    std::shared_ptr<models::BPE> m_tokenizer;
+    std::shared_ptr<BPEModel> m_tokenizer;
+    std::shared_ptr<TokenCache> m_cache;
     std::string m_unk_token;
     bool m_fuse_unk = false;
     std::string m_suffix_indicator;
     std::string m_end_suffix;
     bool m_byte_fallback = false;
+    int m_cache_capacity = 20000;
 };
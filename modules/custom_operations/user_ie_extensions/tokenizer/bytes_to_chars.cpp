@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "openvino/core/parallel.hpp"
+
 #include "bytes_to_chars.hpp"
 #include "utils.hpp"
 
@@ -269,6 +271,26 @@ const std::array<std::vector<uint8_t>, 256> create_bytes_to_chars_map() {
     }};
 }
 
+const std::array<std::array<uint8_t, 2>, 256> create_flat_bytes_to_chars_map() {
+    const auto bytes_to_chars = create_bytes_to_chars_map();
+    std::array<std::array<uint8_t, 2>, 256> flat_map;
+    for (size_t byte = 0; byte < bytes_to_chars.size(); ++byte) {
+        // printable ASCII chars are not looked up in the table
+        flat_map[byte] = bytes_to_chars[byte].size() == 2
+            ? std::array<uint8_t, 2>{bytes_to_chars[byte][0], bytes_to_chars[byte][1]}
+            : std::array<uint8_t, 2>{bytes_to_chars[byte][0], 0};
+    }
+    return flat_map;
+}
+
+namespace {
+
+// Bytes of this range are mapped to themselves, all the others become two-byte chars
+constexpr uint8_t printable_first = 33;
+constexpr uint8_t printable_last = 126;
+
+}
+
 void BytesToChars::validate_and_infer_types() {
     check_ragged_string_input(this, 0);
     set_ragged_string_output(this, 0, get_input_partial_shape(0));
@@ -283,35 +305,57 @@ bool BytesToChars::evaluate(ov::TensorVector& outputs, const ov::TensorVector& i
 
     OPENVINO_ASSERT(inputs.size() == 5, "Too few inputs passed to BytesToChars, it means it is not converted properly or it is not used in the supported pattern");
 
+    const size_t num_rows = inputs[0].get_size();
+
+    // First pass: exact size of each row, the rows are processed in parallel then
+    std::vector<size_t> row_offsets(num_rows + 1, 0);
+    ov::parallel_for(num_rows, [&](size_t row) {
+        size_t row_size = 0;
+        for(size_t i = ragged_begins[row]; i < ragged_ends[row]; ++i) {
+            const size_t word_len = ends[i] - begins[i];
+            row_size += 2 * word_len - count_bytes_in_range(chars + begins[i], word_len, printable_first, printable_last);
+        }
+        row_offsets[row + 1] = row_size;
+    });
+    for (size_t row = 0; row < num_rows; ++row) {
+        row_offsets[row + 1] += row_offsets[row];
+    }
+
     // Set output shapes
     outputs[0] = inputs[0];
     outputs[1] = inputs[1];
     outputs[2].set_shape(inputs[2].get_shape());
     outputs[3].set_shape(inputs[3].get_shape());
-    outputs[4].set_shape(Shape({inputs[4].get_size() * 2}));
-    const size_t num_elems = inputs[0].get_size();
+    outputs[4].set_shape(Shape({row_offsets[num_rows]}));
 
     // Get pointers in the output tensors
     auto new_begins = outputs[2].data<int32_t>();
     auto new_ends   = outputs[3].data<int32_t>();
     auto new_chars  = outputs[4].data<uint8_t>();
-    uint32_t char_pointer = 0;
 
-    for(size_t j = 0; j < num_elems; ++j) {
+    // Second pass: copy runs of printable chars as is and look up the rest in the table
+    ov::parallel_for(num_rows, [&](size_t row) {
+        size_t char_pointer = row_offsets[row];
 
-        for(size_t i = ragged_begins[j]; i < ragged_ends[j]; ++i) {
-            const auto word_len = ends[i] - begins[i];
+        for(size_t i = ragged_begins[row]; i < ragged_ends[row]; ++i) {
+            const auto word = chars + begins[i];
+            const size_t word_len = ends[i] - begins[i];
             new_begins[i] = char_pointer;
 
-            for (size_t k = 0; k < word_len; ++k) {
-                for (auto byte : m_bytes_to_chars[chars[begins[i] + k]]) {
-                    new_chars[char_pointer++] = byte;
+            for (size_t k = 0; k < word_len;) {
+                const auto run_len = leading_bytes_in_range(word + k, word_len - k, printable_first, printable_last);
+                std::copy_n(word + k, run_len, new_chars + char_pointer);
+                char_pointer += run_len;
+                k += run_len;
+
+                if (k < word_len) {
+                    const auto& mapped = m_bytes_to_chars[word[k++]];
+                    new_chars[char_pointer++] = mapped[0];
+                    new_chars[char_pointer++] = mapped[1];
                 }
             }
             new_ends[i] = char_pointer;
         }
-    }
-    outputs[4].set_shape({char_pointer});
+    });
     return true;
 }
-
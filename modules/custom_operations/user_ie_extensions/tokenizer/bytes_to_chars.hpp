@@ -11,6 +11,9 @@
 
 const std::array<std::vector<uint8_t>, 256> create_bytes_to_chars_map();
 
+// The same map in a flat fixed-width table: bytes out of the printable ASCII range are mapped to two-byte chars
+const std::array<std::array<uint8_t, 2>, 256> create_flat_bytes_to_chars_map();
+
 class BytesToChars : public ov::op::Op {
 public:
     OPENVINO_OP("BytesToChars");
@@ -39,5 +42,5 @@ public:
     }
 
 private:
-    const std::array<std::vector<uint8_t>, 256> m_bytes_to_chars = create_bytes_to_chars_map();
+    const std::array<std::array<uint8_t, 2>, 256> m_bytes_to_chars = create_flat_bytes_to_chars_map();
 };
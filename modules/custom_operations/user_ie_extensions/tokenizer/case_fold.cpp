@@ -18,8 +18,9 @@ void CaseFold::validate_and_infer_types() {
 bool CaseFold::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
     return evaluate_normalization_helper(
         outputs, inputs,
-        [](const std::string& str) {
+        [](std::string_view str, std::string& normalized) {
             using namespace paddlenlp::fast_tokenizer;
-            return normalizers::NormalizedString(str).Lowercase().GetStr();
+            normalized = normalizers::NormalizedString(std::string(str)).Lowercase().GetStr();
+            return true;
         });
 }
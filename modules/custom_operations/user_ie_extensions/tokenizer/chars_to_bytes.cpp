@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "openvino/core/parallel.hpp"
+
 #include "chars_to_bytes.hpp"
 #include "bytes_to_chars.hpp"
 #include "utils.hpp"
@@ -35,34 +37,62 @@ bool CharsToBytes::evaluate(ov::TensorVector& outputs, const ov::TensorVector& i
     auto ends   = inputs[3].data<const int32_t>();
     auto chars  = inputs[4].data<const uint8_t>();
 
+    const size_t num_rows = inputs[0].get_size();
+
+    // First pass: every char gives one byte, so the row size is the number of bytes without continuation ones
+    std::vector<size_t> row_offsets(num_rows + 1, 0);
+    ov::parallel_for(num_rows, [&](size_t row) {
+        size_t row_size = 0;
+        for(size_t col = ragged_begins[row]; col < ragged_ends[row]; ++col) {
+            const size_t word_len = ends[col] - begins[col];
+            row_size += word_len - count_bytes_in_range(chars + begins[col], word_len, 0x80, 0xBF);
+        }
+        row_offsets[row + 1] = row_size;
+    });
+    for (size_t row = 0; row < num_rows; ++row) {
+        row_offsets[row + 1] += row_offsets[row];
+    }
+
     outputs[0].set_shape(inputs[0].get_shape());
     outputs[1].set_shape(inputs[1].get_shape());
-    outputs[2].set_shape(Shape({inputs[4].get_size()}));
-    const size_t num_rows = inputs[0].get_size();
+    outputs[2].set_shape(Shape({row_offsets[num_rows]}));
 
     // Get pointers in the output tensors
     auto new_begins = outputs[0].data<int32_t>();
     auto new_ends   = outputs[1].data<int32_t>();
     auto new_chars  = outputs[2].data<uint8_t>();
-    uint32_t char_pointer = 0;
 
-    for(size_t row = 0; row < num_rows; ++row) {
+    // Second pass: copy runs of one byte chars as is and look up two byte chars in the table
+    ov::parallel_for(num_rows, [&](size_t row) {
+        size_t char_pointer = row_offsets[row];
         new_begins[row] = char_pointer;
+
         for(size_t col = ragged_begins[row]; col < ragged_ends[row]; ++col) {
-            const auto word_len = ends[col] - begins[col];
-
-            for (size_t k = 0; k < word_len; ++k) {
-                const auto first_byte = chars[begins[col] + k];
-                if (first_byte < m_one_byte_border) {
-                    new_chars[char_pointer++] = first_byte;
-                } else {
-                    const auto second_byte = chars[begins[col] + (++k)];
-                    new_chars[char_pointer++] = m_pair_map[first_byte - m_first_byte_offset][second_byte - m_second_byte_offset];
+            const auto word = chars + begins[col];
+            const size_t word_len = ends[col] - begins[col];
+
+            for (size_t k = 0; k < word_len;) {
+                const auto run_len = leading_bytes_in_range(word + k, word_len - k, 0, m_one_byte_border - 1);
+                std::copy_n(word + k, run_len, new_chars + char_pointer);
+                char_pointer += run_len;
+                k += run_len;
+
+                if (k == word_len) {
+                    break;
                 }
+                const auto first_byte = word[k++];
+                if ((first_byte & 0xC0) == 0x80) {
+                    continue;   // stray continuation byte doesn't start a char
+                }
+                const bool is_pair = k < word_len && (word[k] & 0xC0) == 0x80 &&
+                    first_byte >= m_first_byte_offset && first_byte - m_first_byte_offset < m_pair_map.size();
+                // chars out of the byte-level alphabet are not expected, keep their first byte to match the row size
+                new_chars[char_pointer++] = is_pair
+                    ? m_pair_map[first_byte - m_first_byte_offset][word[k++] - m_second_byte_offset]
+                    : first_byte;
             }
-        };
+        }
         new_ends[row] = char_pointer;
-    }
-    outputs[2].set_shape({char_pointer});
+    });
     return true;
 }
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
+#include "openvino/core/parallel.hpp"
+
 #include "combine_segments.hpp"
 #include "utils.hpp"
 
@@ -44,7 +48,6 @@ bool CombineSegments::evaluate(ov::TensorVector& outputs, const ov::TensorVector
     auto element_type = inputs[2].get_element_type();
     auto elem_size = element_type.size();
     size_t max_nelems = 0;
-    size_t flat_out_size = 0;
     Shape ps;
 
     for(size_t i = 0; i < num_of_ragged; ++i) {
@@ -60,19 +63,28 @@ bool CombineSegments::evaluate(ov::TensorVector& outputs, const ov::TensorVector
         max_nelems = std::max(max_nelems, nelems.back());
     }
 
-    // flat_out_size is going to be an estimation of the final size
-    // This is only an estimation, not the exact output size, because ragged tensor may have gaps in the representation
+    auto ids = reinterpret_cast<const char*>(inputs.back().data());
+    size_t id_type_size = inputs.back().get_element_type().size();
+
+    // scalar segments are broadcasted to all rows
+    auto segment_index = [&](size_t segment, size_t row) {
+        return nelems[segment] == 1 ? 0 : row;
+    };
 
-    for(size_t i = 0; i < num_of_ragged; ++i) {
-        if(nelems[i] == 1) {
-            flat_out_size += max_nelems * inputs[3*i + 2].get_size(); // broadcast
-        } else {
-            flat_out_size += inputs[3*i + 2].get_size();    // FIXME: doesn't work for overlapped ragged regions
+    // First pass: exact number of elements in each row, ragged regions may have gaps or overlap
+    std::vector<size_t> row_offsets(max_nelems + 1, 0);
+    ov::parallel_for(max_nelems, [&](size_t row) {
+        size_t row_size = 0;
+        for(size_t j = 0; j < num_of_ragged; ++j) {
+            const auto idx = segment_index(j, row);
+            row_size += ends[j][idx] - begins[j][idx];
         }
+        row_offsets[row + 1] = row_size;
+    });
+    for(size_t row = 0; row < max_nelems; ++row) {
+        row_offsets[row + 1] += row_offsets[row];
     }
-
-    auto ids = reinterpret_cast<const char*>(inputs.back().data());
-    size_t id_type_size = inputs.back().get_element_type().size();
+    const size_t flat_out_size = row_offsets[max_nelems];
 
     outputs[3*0 + 0].set_shape(ps);
     outputs[3*0 + 1].set_shape(ps);
@@ -93,43 +105,25 @@ bool CombineSegments::evaluate(ov::TensorVector& outputs, const ov::TensorVector
     auto out_id_ends = outputs[3*1 + 1].data<int32_t>();
     auto out_ids = reinterpret_cast<char*>(outputs[3*1 + 2].data());
 
-    auto out_elems_orig = out_elems;
-    auto out_ids_orig = out_ids;
-    size_t out_offset = 0;
-
-    for(size_t i = 0; i < max_nelems; ++i) {
-        out_elem_begins[i] = out_offset;
-        out_id_begins[i] = out_offset;
+    // Second pass: rows are filled independently starting from the known offsets
+    ov::parallel_for(max_nelems, [&](size_t row) {
+        size_t out_offset = row_offsets[row];
+        out_elem_begins[row] = out_offset;
+        out_id_begins[row] = out_offset;
 
         for(size_t j = 0; j < num_of_ragged; ++j) {
-            const char* begin;
-            size_t len;
-            if(nelems[j] == 1) {
-                begin = elems[j] + elem_size*begins[j][0];
-                len = ends[j][0] - begins[j][0];
-            } else {
-                begin = elems[j] + elem_size*begins[j][i];
-                len = ends[j][i] - begins[j][i];
-            }
-            auto end = begin + elem_size*len;
-            out_elems = std::copy(begin, end, out_elems);
-            for(size_t k = 0; k < len; ++k) {
-                out_ids = std::copy(ids + id_type_size*j, ids + id_type_size*(j + 1), out_ids);
+            const auto idx = segment_index(j, row);
+            const size_t len = ends[j][idx] - begins[j][idx];
+            if (len > 0) {
+                std::memcpy(out_elems + elem_size*out_offset, elems[j] + elem_size*begins[j][idx], elem_size*len);
+                fill_elements(out_ids + id_type_size*out_offset, len, ids + id_type_size*j, id_type_size);
             }
             out_offset += len;
         }
 
-        out_elem_ends[i] = out_offset;
-        out_id_ends[i] = out_offset;
-    }
-
-    OPENVINO_ASSERT(out_offset <= flat_out_size);
+        out_elem_ends[row] = out_offset;
+        out_id_ends[row] = out_offset;
+    });
 
-    outputs[3*0 + 2].set_shape({out_offset});
-    outputs[3*1 + 2].set_shape({out_offset});
-
-    OPENVINO_ASSERT(out_elems == out_elems_orig + outputs[3*0 + 2].get_byte_size());
-    OPENVINO_ASSERT(out_ids == out_ids_orig + outputs[3*1 + 2].get_byte_size());
     return true;
 }
-
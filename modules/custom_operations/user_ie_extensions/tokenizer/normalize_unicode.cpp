@@ -16,13 +16,13 @@ using namespace ov;
 
 namespace {
 using namespace paddlenlp::fast_tokenizer::normalizers;
-using NormalizersMap = std::map<std::string, std::function<std::string(const std::string&)>>;
+using NormalizersMap = std::map<std::string, std::function<bool(std::string_view, std::string&)>>;
 
 const NormalizersMap normalizers = {
-    {"NFD", [](const std::string& str) { return NormalizedString(str).NFD().GetStr(); }},
-    {"NFC", [](const std::string& str) { return NormalizedString(str).NFC().GetStr(); }},
-    {"NFKD", [](const std::string& str) { return NormalizedString(str).NFKD().GetStr(); }},
-    {"NFKC", [](const std::string& str) { return NormalizedString(str).NFKC().GetStr(); }},
+    {"NFD", [](std::string_view str, std::string& normalized) { normalized = NormalizedString(std::string(str)).NFD().GetStr(); return true; }},
+    {"NFC", [](std::string_view str, std::string& normalized) { normalized = NormalizedString(std::string(str)).NFC().GetStr(); return true; }},
+    {"NFKD", [](std::string_view str, std::string& normalized) { normalized = NormalizedString(std::string(str)).NFKD().GetStr(); return true; }},
+    {"NFKC", [](std::string_view str, std::string& normalized) { normalized = NormalizedString(std::string(str)).NFKC().GetStr(); return true; }},
 };
 
 }
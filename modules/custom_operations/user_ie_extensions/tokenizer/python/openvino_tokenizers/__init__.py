@@ -15,7 +15,13 @@ from openvino.runtime.utils.node_factory import NodeFactory
 from .__version__ import __version__
 from .convert_tokenizer import convert_tokenizer
 from .str_pack import pack_strings, unpack_strings
-from .utils import add_greedy_decoding, connect_models
+from .utils import (
+    IncrementalDetokenizer,
+    add_greedy_decoding,
+    add_incremental_decoding,
+    connect_models,
+    fuse_regex_normalizations,
+)
 
 _ext_name = "openvino_tokenizers"
 if sys.platform == "win32":
@@ -9,6 +9,9 @@ TOKEN_TYPE_IDS_INPUT_NAME = "token_type_ids"
 LOGITS_OUTPUT_NAME = "logits"
 TOKEN_IDS_OUTPUT_NAME = "token_ids"
 STRING_OUTPUT_NAME = "string_output"
+PENDING_BYTES_INPUT_NAME = "pending_bytes"
+PENDING_BYTES_OUTPUT_NAME = "pending_bytes_output"
+MAX_PENDING_BYTES = 3  # the longest incomplete UTF-8 character
 
 GREEDY_DECODER_NAME = "greedy_decoder"
 
@@ -444,40 +444,29 @@ def convert_sentencepiece_model_tokenizer(
             "add_eos": add_eos_token,
             "reverse": False,
             "alpha": 0.0,
+            "ragged_output": True,
         },
     )
 
-    indices, values, dense_shape = tokenizer_node.outputs()
+    begins, ends, values = tokenizer_node.outputs()
 
+    max_length = opset.reduce_max(opset.subtract(ends, begins), make_constant_node(0, Type.i32))
     default_value = make_constant_node(hf_tokenizer.pad_token_id or 0, values.element_type)
-    broadcast = opset.broadcast(default_value, dense_shape)
-    scatternd_input_ids = _get_factory().create(
-        "ScatterNDUpdate",
-        [broadcast, indices, values],  # FIXME: pad left side instead of right
-    )
+    input_ids, mask = _get_factory().create(
+        "RaggedToDense",
+        [begins, ends, values, max_length.output(0), default_value.output(0)],  # FIXME: pad left side instead of right
+    ).outputs()
 
     if is_chatglm:
-        prefix_tokens = make_constant_node(
-            np.array([hf_tokenizer.get_prefix_tokens()]), dtype=scatternd_input_ids.output(0).element_type
-        )
-        scatternd_input_ids = opset.concat([prefix_tokens, scatternd_input_ids], axis=-1)
+        prefix_tokens = make_constant_node(np.array([hf_tokenizer.get_prefix_tokens()]), dtype=input_ids.element_type)
+        input_ids = opset.concat([prefix_tokens, input_ids], axis=-1).output(0)
 
-    scatternd_input_ids.output(0).tensor.add_names({TOKEN_IDS_INPUT_NAME})
+    input_ids.tensor.add_names({TOKEN_IDS_INPUT_NAME})
 
-    outputs = scatternd_input_ids.outputs()
+    outputs = [input_ids]
 
     if add_attention_mask:
-        attention_mask = _get_factory().create(
-            "ScatterNDUpdate",
-            [
-                broadcast,
-                indices,
-                opset.broadcast(
-                    make_constant_node(1, values.element_type),
-                    opset.shape_of(values),
-                ),
-            ],
-        )
+        attention_mask = opset.convert(mask, values.element_type)
 
         if is_chatglm:
             attention_prefix = make_constant_node(
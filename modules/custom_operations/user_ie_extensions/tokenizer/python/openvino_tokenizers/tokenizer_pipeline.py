@@ -24,6 +24,7 @@ from .constants import (
     TOKENIZER_NAME,
 )
 from .str_pack import pack_string, pack_strings
+from .utils import fuse_regex_normalizations
 
 
 class BasePipelineStep:
@@ -343,6 +344,7 @@ class BPETokenizationStep(TokenizationModelStep):
     end_suffix: str = ""
     byte_fallback: bool = False
     added_tokens: Optional[Dict[int, str]] = None
+    cache_capacity: int = 20000  # number of words with cached tokenization results, 0 disables the cache
 
     def __post_init__(self):
         if self.added_tokens is not None:
@@ -360,6 +362,7 @@ class BPETokenizationStep(TokenizationModelStep):
             fuse_unk=tokenizer_json["model"]["fuse_unk"] or False,
             suffix_indicator=tokenizer_json["model"]["continuing_subword_prefix"] or "",
             end_suffix=tokenizer_json["model"]["end_of_word_suffix"] or "",
+            byte_fallback=tokenizer_json["model"].get("byte_fallback") or False,
             vocab=vocab,
             merges=tokenizer_json["model"]["merges"],
             added_tokens={
@@ -406,6 +409,7 @@ class BPETokenizationStep(TokenizationModelStep):
                     "suffix_indicator": self.suffix_indicator,
                     "end_suffix": self.end_suffix,
                     "byte_fallback": self.byte_fallback,
+                    "cache_capacity": self.cache_capacity,
                 },
             )
             .outputs()
@@ -793,7 +797,7 @@ class TokenizerPipeline:
         for step in self.post_tokenization_steps:
             processing_outputs = step.get_ov_subgraph(processing_outputs)
 
-        return Model(processing_outputs, string_inputs, name=TOKENIZER_NAME)
+        return fuse_regex_normalizations(Model(processing_outputs, string_inputs, name=TOKENIZER_NAME))
 
     @property
     def normalization_steps(self) -> List[NormalizationStep]:
@@ -839,6 +843,6 @@ class TokenizerPipeline:
         input_node = op.Parameter(Type.i32, PartialShape(["?", "?"]))
         token_ids = input_node
         outputs = self.create_decoding_pipeline([token_ids])
-        model = Model(outputs, [input_node], name=DETOKENIZER_NAME)
+        model = fuse_regex_normalizations(Model(outputs, [input_node], name=DETOKENIZER_NAME))
         model.output().tensor.add_names({STRING_OUTPUT_NAME})
         return model
@@ -3,13 +3,23 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import logging
-from typing import Dict, Optional, Sequence, Tuple, Union
+from typing import Dict, List, Optional, Sequence, Tuple, Union
 
-from openvino import Model, Type
+import numpy as np
+from openvino import Core, Model, PartialShape, Type
 from openvino.preprocess import PrePostProcessor
+from openvino.runtime import Node, op
 from openvino.runtime import opset12 as opset
+from openvino.runtime.exceptions import OVTypeError
 
-from .constants import LOGITS_OUTPUT_NAME, TOKEN_IDS_OUTPUT_NAME
+from .constants import (
+    LOGITS_OUTPUT_NAME,
+    MAX_PENDING_BYTES,
+    PENDING_BYTES_INPUT_NAME,
+    PENDING_BYTES_OUTPUT_NAME,
+    STRING_OUTPUT_NAME,
+    TOKEN_IDS_OUTPUT_NAME,
+)
 
 
 logger = logging.getLogger(__name__)
@@ -109,3 +119,161 @@ def change_outputs_type(model: Model, output_type: Type) -> Model:
     for idx, _ in enumerate(model.outputs):
         ppp.output(idx).tensor().set_element_type(output_type)
     return ppp.build()
+
+
+def fuse_regex_normalizations(model: Model) -> Model:
+    """
+    Replaces chains of consecutive RegexNormalization nodes with single nodes that apply all replacements of a chain.
+
+    The fused node finds the applicable replacements for a string with one multi-pattern scan and copies the string
+    once instead of a copy pass per node. The replacements are applied in the original order, so the result is the same.
+    """
+    from . import _get_factory
+
+    for node in model.get_ordered_ops():
+        if node.get_type_name() != "RegexNormalization":
+            continue
+
+        string_inputs = node.input_values()[:3]
+        producer = string_inputs[0].get_node()
+        if producer.get_type_name() != "RegexNormalization":
+            continue
+        # all string outputs of the previous node should go to this node only
+        if any(
+            value.get_node().get_name() != producer.get_name() or value.get_index() != idx
+            for idx, value in enumerate(string_inputs)
+        ) or any(len(output.get_target_inputs()) != 1 for output in producer.outputs()):
+            continue
+
+        fused = _get_factory().create("RegexNormalization", [*producer.input_values(), *node.input_values()[3:]])
+        for old_output, new_output in zip(node.outputs(), fused.outputs()):
+            old_output.replace(new_output)
+
+    model.validate_nodes_and_infer_types()
+    return model
+
+
+# operations that decode each token independently of its neighbours, so they can be applied to the new tokens only
+TOKEN_LOCAL_DECODING_OPS = {
+    "Parameter",
+    "Constant",
+    "Convert",
+    "StringTensorUnpack",
+    "VocabDecoder",
+    "CharsToBytes",
+    "SentencepieceStreamDetokenizer",
+    "RegexNormalization",
+}
+
+
+def check_token_local_decoding(string_pack: Node) -> None:
+    """
+    Raises OVTypeError if some operation before the StringTensorPack of a detokenizer looks at the neighbouring tokens.
+    """
+    from .tokenizer_pipeline import RegexDecodingStep
+
+    # the replacements of the clean up remove spaces before the punctuation, that comes with the next tokens
+    clean_up_pattern = RegexDecodingStep.clean_up_tokenization_spaces().regex_search_pattern
+
+    visited = set()
+    nodes = [value.get_node() for value in string_pack.input_values()]
+    while nodes:
+        node = nodes.pop()
+        if node.get_name() in visited:
+            continue
+        visited.add(node.get_name())
+
+        if node.get_type_name() not in TOKEN_LOCAL_DECODING_OPS:
+            raise OVTypeError(
+                f"{node.get_type_name()} decodes tokens depending on their neighbours and can't be used for incremental "
+                "decoding, convert the detokenizer with `streaming_detokenizer=True`"
+            )
+        if node.get_type_name() == "RegexNormalization":
+            # search patterns and replacements follow the normalized string
+            patterns = [value.get_node() for value in node.input_values()[3::2]]
+            if any(
+                pattern.get_type_name() == "Constant" and bytes(pattern.get_data()).decode() == clean_up_pattern
+                for pattern in patterns
+            ):
+                raise OVTypeError(
+                    "Cleaning up tokenization spaces depends on the next tokens and can't be used for incremental "
+                    "decoding, convert the detokenizer with `clean_up_tokenization_spaces=False`"
+                )
+
+        nodes.extend(value.get_node() for value in node.input_values())
+
+
+def add_incremental_decoding(detokenizer: Model) -> Model:
+    """
+    Makes the detokenizer decode only new token ids of each generation step.
+
+    The resulting model has an additional pending bytes input and output: the output holds an incomplete UTF-8
+    character at the end of the decoded text and should be passed to the next step, zeros for the first step.
+    The detokenizer should produce the text of a sequence as a concatenation of its token texts, e.g. sentencepiece
+    detokenizers should be converted with `streaming_detokenizer=True`, OVTypeError is raised otherwise.
+    """
+    from . import _get_factory
+
+    string_pack = detokenizer.output(STRING_OUTPUT_NAME).get_node().input_value(0).get_node()
+    if string_pack.get_type_name() != "StringTensorPack":
+        raise OVTypeError(f"Expected StringTensorPack before the detokenizer output, got {string_pack.get_type_name()}")
+    check_token_local_decoding(string_pack)
+
+    pending_bytes = op.Parameter(Type.u8, PartialShape(["?", MAX_PENDING_BYTES]))
+    pending_bytes.output(0).tensor.add_names({PENDING_BYTES_INPUT_NAME})
+
+    stream_buffer = _get_factory().create(
+        "UTF8StreamBuffer", [*string_pack.input_values(), pending_bytes.output(0)]
+    ).outputs()
+
+    string_output = _get_factory().create("StringTensorPack", stream_buffer[:3]).outputs()
+    string_output[0].tensor.add_names({STRING_OUTPUT_NAME})
+    stream_buffer[3].tensor.add_names({PENDING_BYTES_OUTPUT_NAME})
+
+    model = Model(
+        [string_output[0], stream_buffer[3]],
+        [*detokenizer.get_parameters(), pending_bytes],
+        detokenizer.get_name(),
+    )
+    model.validate_nodes_and_infer_types()
+    return model
+
+
+class IncrementalDetokenizer:
+    """
+    Keeps the decoding state of generated sequences between the steps of a generation loop.
+    Each step takes only new token ids of the sequences and returns only new text, so the total
+    detokenization cost is linear in the output length.
+
+    Usage example:
+        incremental_detokenizer = IncrementalDetokenizer(ov_detokenizer)
+        for new_token_ids in generation_loop():  # [batch, number of new tokens]
+            print(incremental_detokenizer.step(new_token_ids)[0], end="")
+        print(incremental_detokenizer.flush()[0])
+    """
+
+    def __init__(self, detokenizer: Model, device: str = "CPU") -> None:
+        self.compiled_detokenizer = Core().compile_model(add_incremental_decoding(detokenizer), device)
+        self.infer_request = self.compiled_detokenizer.create_infer_request()
+        self.pending_bytes: Optional[np.ndarray] = None
+
+    def reset(self, batch_size: int = 1) -> None:
+        self.pending_bytes = np.zeros((batch_size, MAX_PENDING_BYTES), dtype=np.uint8)
+
+    def step(self, token_ids: np.ndarray) -> List[str]:
+        token_ids = np.atleast_2d(token_ids).astype(np.int32)
+        if self.pending_bytes is None or len(self.pending_bytes) != len(token_ids):
+            self.reset(len(token_ids))
+
+        result = self.infer_request.infer([token_ids, self.pending_bytes])
+        self.pending_bytes = result[PENDING_BYTES_OUTPUT_NAME].copy()
+        return list(result[STRING_OUTPUT_NAME])
+
+    def flush(self) -> List[str]:
+        """Returns the bytes left at the end of the sequences and resets the state"""
+        if self.pending_bytes is None:
+            return []
+
+        tails = [bytes(row[row != 0]).decode("utf-8", errors="replace") for row in self.pending_bytes]
+        self.reset(len(self.pending_bytes))
+        return tails
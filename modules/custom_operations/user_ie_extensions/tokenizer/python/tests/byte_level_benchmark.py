@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Measures throughput of the byte-level BytesToChars and CharsToBytes operations in MB/s of the input text.
+Each sentence goes to the operation as a single word, so long documents are processed as long words.
+
+Usage example:
+    python byte_level_benchmark.py --batch-size 16 256 --doc-size 1000 100000 --threads 1 4
+"""
+
+import argparse
+import time
+from typing import Callable, List
+
+from openvino import Core, Model, PartialShape, Type
+from openvino.runtime import op
+from openvino_tokenizers import _get_factory
+from openvino_tokenizers.tokenizer_pipeline import TokenizerPipeline
+from tokenizers_test import eng_test_strings, multilingual_test_strings
+
+
+core = Core()
+
+
+def bytes_to_unicode() -> Callable[[bytes], str]:
+    # the same byte-level alphabet as in GPT-2 tokenizer
+    byte_values = [*range(ord("!"), ord("~") + 1), *range(ord("¡"), ord("¬") + 1), *range(ord("®"), ord("ÿ") + 1)]
+    char_codes = byte_values[:]
+    for byte in range(256):
+        if byte not in byte_values:
+            byte_values.append(byte)
+            char_codes.append(256 + len(char_codes) - 188)
+    mapping = dict(zip(byte_values, map(chr, char_codes)))
+    return lambda text: "".join(mapping[byte] for byte in text)
+
+
+def make_byte_level_model(operation: str) -> Model:
+    string_input = op.Parameter(Type.string, PartialShape(["?"]))
+    unpacked = _get_factory().create("StringTensorUnpack", string_input.outputs()).outputs()
+    ragged = TokenizerPipeline.add_ragged_dimension(unpacked)
+    outputs = _get_factory().create(operation, ragged).outputs()
+    # BytesToChars keeps the ragged dimension while CharsToBytes joins the words of each row
+    string_output = _get_factory().create("StringTensorPack", outputs[-3:]).outputs()
+    return Model(string_output, [string_input], operation)
+
+
+def make_batch(batch_size: int, doc_size: int) -> List[str]:
+    corpus = " ".join(eng_test_strings + multilingual_test_strings)
+    document = (corpus * (doc_size // len(corpus) + 1))[:doc_size]
+    return [document] * batch_size
+
+
+def measure(compiled_model, batch: List[str], repeat: int) -> float:
+    infer_request = compiled_model.create_infer_request()
+    infer_request.infer([batch])  # warm up
+
+    start = time.perf_counter()
+    for _ in range(repeat):
+        infer_request.infer([batch])
+    return (time.perf_counter() - start) / repeat
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--batch-size", type=int, nargs="+", default=[16, 256])
+    parser.add_argument("--doc-size", type=int, nargs="+", default=[1000, 100000], help="document size in chars")
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 4])
+    parser.add_argument("--repeat", type=int, default=20)
+    args = parser.parse_args()
+
+    to_byte_level = bytes_to_unicode()
+    models = {operation: make_byte_level_model(operation) for operation in ("BytesToChars", "CharsToBytes")}
+
+    print(f"{'operation':>14} {'batch':>6} {'doc size':>9} {'threads':>8} {'MB/s':>10}")
+    for batch_size in args.batch_size:
+        for doc_size in args.doc_size:
+            text_batch = make_batch(batch_size, doc_size)
+            byte_level_batch = [to_byte_level(text.encode()) for text in text_batch]
+
+            for num_threads in args.threads:
+                config = {"INFERENCE_NUM_THREADS": num_threads}
+                for operation, batch in (("BytesToChars", text_batch), ("CharsToBytes", byte_level_batch)):
+                    compiled_model = core.compile_model(models[operation], "CPU", config)
+                    # both operations must reproduce the python implementation of the mapping
+                    expected = byte_level_batch if operation == "BytesToChars" else text_batch
+                    assert list(compiled_model([batch])[0]) == expected, f"{operation} output is incorrect"
+
+                    input_megabytes = sum(len(text.encode()) for text in batch) / 2**20
+                    elapsed = measure(compiled_model, batch, args.repeat)
+                    print(f"{operation:>14} {batch_size:>6} {doc_size:>9} {num_threads:>8} {input_megabytes / elapsed:>10.1f}")
+
+
+if __name__ == "__main__":
+    main()
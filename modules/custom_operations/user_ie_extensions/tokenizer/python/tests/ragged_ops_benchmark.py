@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Measures latency of the BERT-style post-processing: CombineSegments adds [CLS] and [SEP] tokens to the ragged
+token ids and RaggedToDense pads the ids and the token type ids to the target length.
+
+Usage example:
+    python ragged_ops_benchmark.py --batch-size 1 16 256 --pad-length 128 512 --threads 1 4
+"""
+
+import argparse
+import time
+from typing import List, Tuple
+
+import numpy as np
+from openvino import Core, Model, PartialShape, Type
+from openvino.runtime import op
+from openvino.runtime.utils.types import make_constant_node
+from openvino_tokenizers import _get_factory
+
+
+core = Core()
+
+CLS_TOKEN_ID = 101
+SEP_TOKEN_ID = 102
+PAD_TOKEN_ID = 0
+
+
+def make_single_token(token_id: int) -> List:
+    return [
+        *make_constant_node(0, Type.i32).outputs(),
+        *make_constant_node(1, Type.i32).outputs(),
+        make_constant_node(np.array([token_id]), Type.i32).output(0),
+    ]
+
+
+def make_post_processing_model(pad_length: int) -> Model:
+    ragged_inputs = [op.Parameter(Type.i32, PartialShape(["?"])) for _ in range(3)]
+    combined = _get_factory().create(
+        "CombineSegments",
+        [
+            *make_single_token(CLS_TOKEN_ID),
+            *[ragged_input.output(0) for ragged_input in ragged_inputs],
+            *make_single_token(SEP_TOKEN_ID),
+            make_constant_node(np.array([0, 0, 0]), Type.i32).output(0),
+        ],
+    ).outputs()
+
+    max_length = make_constant_node(pad_length, Type.i32).outputs()
+    pad_value = make_constant_node(PAD_TOKEN_ID, Type.i32).outputs()
+    input_ids, attention_mask = _get_factory().create("RaggedToDense", combined[:3] + max_length + pad_value).outputs()
+    token_type_ids = _get_factory().create("RaggedToDense", combined[3:] + max_length + pad_value).output(0)
+    return Model([input_ids, attention_mask, token_type_ids], ragged_inputs, "post_processing")
+
+
+def make_batch(batch_size: int, pad_length: int, rng: np.random.Generator) -> Tuple[List[np.ndarray], np.ndarray]:
+    # some sequences are longer than the target length to check truncation
+    lengths = rng.integers(0, pad_length + pad_length // 4, size=batch_size, dtype=np.int32)
+    ends = np.cumsum(lengths, dtype=np.int32)
+    begins = ends - lengths
+    token_ids = rng.integers(1000, 30000, size=int(lengths.sum()), dtype=np.int32)
+
+    expected = np.full((batch_size, pad_length), PAD_TOKEN_ID, dtype=np.int32)
+    for row, (begin, end) in enumerate(zip(begins, ends)):
+        sequence = [CLS_TOKEN_ID, *token_ids[begin:end], SEP_TOKEN_ID][:pad_length]
+        expected[row, : len(sequence)] = sequence
+    return [begins, ends, token_ids], expected
+
+
+def measure(compiled_model, inputs: List[np.ndarray], repeat: int) -> float:
+    infer_request = compiled_model.create_infer_request()
+    infer_request.infer(inputs)  # warm up
+
+    start = time.perf_counter()
+    for _ in range(repeat):
+        infer_request.infer(inputs)
+    return (time.perf_counter() - start) / repeat
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--batch-size", type=int, nargs="+", default=[1, 16, 256])
+    parser.add_argument("--pad-length", type=int, nargs="+", default=[128, 512])
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 4])
+    parser.add_argument("--repeat", type=int, default=100)
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(42)
+
+    print(f"{'batch':>6} {'pad length':>11} {'threads':>8} {'latency, us':>12}")
+    for pad_length in args.pad_length:
+        model = make_post_processing_model(pad_length)
+        for batch_size in args.batch_size:
+            inputs, expected = make_batch(batch_size, pad_length, rng)
+
+            for num_threads in args.threads:
+                compiled_model = core.compile_model(model, "CPU", {"INFERENCE_NUM_THREADS": num_threads})
+                input_ids, attention_mask, token_type_ids = compiled_model(inputs).values()
+                assert np.array_equal(input_ids, expected), "Padded input ids are incorrect"
+                assert np.array_equal(attention_mask, expected != PAD_TOKEN_ID), "Attention mask is incorrect"
+                assert not token_type_ids.any(), "Token type ids are incorrect"
+
+                elapsed = measure(compiled_model, inputs, args.repeat)
+                print(f"{batch_size:>6} {pad_length:>11} {num_threads:>8} {elapsed * 1e6:>12.1f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,139 @@
+# -*- coding: utf-8 -*-
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Measures how the tokenizer model scales with the number of inference threads.
+With --allocations counts malloc calls per 1k sentences instead, the mode works on Linux with glibc only.
+
+Usage example:
+    python tokenizer_benchmark.py gpt2 --batch-size 64 256 --threads 1 2 4 8
+    python tokenizer_benchmark.py gpt2 --batch-size 1000 --allocations
+"""
+
+import argparse
+import ctypes
+import os
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List, Tuple
+
+import numpy as np
+from openvino import Core
+from openvino_tokenizers import convert_tokenizer
+from tokenizers_test import eng_test_strings, multilingual_test_strings
+from transformers import AutoTokenizer
+
+
+core = Core()
+
+MALLOC_COUNTER_SOURCE = """
+#include <stddef.h>
+extern void* __libc_malloc(size_t size);
+static unsigned long long calls = 0;
+void* malloc(size_t size) {
+    __atomic_fetch_add(&calls, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+unsigned long long malloc_calls(void) {
+    return __atomic_load_n(&calls, __ATOMIC_RELAXED);
+}
+"""
+MALLOC_COUNTER_ENV = "OV_TOKENIZERS_MALLOC_COUNTER"
+
+
+def make_batch(batch_size: int) -> List[str]:
+    corpus = eng_test_strings + multilingual_test_strings
+    return [corpus[idx % len(corpus)] for idx in range(batch_size)]
+
+
+def run(compiled_tokenizer, batch: List[str], repeat: int) -> Tuple[float, Dict[str, np.ndarray]]:
+    infer_request = compiled_tokenizer.create_infer_request()
+    result = infer_request.infer([batch])  # warm up
+
+    start = time.perf_counter()
+    for _ in range(repeat):
+        infer_request.infer([batch])
+    elapsed = (time.perf_counter() - start) / repeat
+
+    return elapsed, {output.any_name: value.copy() for output, value in result.items()}
+
+
+def preload_malloc_counter() -> None:
+    """Builds the malloc counter library and restarts the script with it preloaded"""
+    if MALLOC_COUNTER_ENV in os.environ:
+        return
+
+    build_dir = tempfile.mkdtemp()
+    source_path = os.path.join(build_dir, "malloc_counter.c")
+    library_path = os.path.join(build_dir, "malloc_counter.so")
+    with open(source_path, "w") as source_file:
+        source_file.write(MALLOC_COUNTER_SOURCE)
+    subprocess.run(["cc", "-O2", "-shared", "-fPIC", source_path, "-o", library_path], check=True)
+
+    env = dict(os.environ, LD_PRELOAD=library_path, **{MALLOC_COUNTER_ENV: library_path})
+    os.execve(sys.executable, [sys.executable] + sys.argv, env)
+
+
+def count_allocations(compiled_tokenizer, batch: List[str], repeat: int) -> float:
+    malloc_calls = ctypes.CDLL(os.environ[MALLOC_COUNTER_ENV]).malloc_calls
+    malloc_calls.restype = ctypes.c_ulonglong
+
+    infer_request = compiled_tokenizer.create_infer_request()
+    infer_request.infer([batch])  # warm up
+
+    # the count includes string packing in the python bindings, which is the same for every build of the extension
+    start = malloc_calls()
+    for _ in range(repeat):
+        infer_request.infer([batch])
+    total = malloc_calls() - start
+    return total / repeat / len(batch) * 1000
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model", help="HuggingFace Hub id or path to the tokenizer")
+    parser.add_argument("--batch-size", type=int, nargs="+", default=[64, 256])
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4, 8])
+    parser.add_argument("--repeat", type=int, default=20)
+    parser.add_argument("--allocations", action="store_true", help="count malloc calls per 1k sentences")
+    args = parser.parse_args()
+
+    if args.allocations:
+        preload_malloc_counter()
+
+    hf_tokenizer = AutoTokenizer.from_pretrained(args.model, trust_remote_code=True)
+    ov_tokenizer = convert_tokenizer(hf_tokenizer, with_detokenizer=False)
+
+    if args.allocations:
+        print(f"{'batch':>8} {'threads':>8} {'mallocs per 1k sentences':>26}")
+        for batch_size in args.batch_size:
+            batch = make_batch(batch_size)
+            for num_threads in args.threads:
+                compiled_tokenizer = core.compile_model(ov_tokenizer, "CPU", {"INFERENCE_NUM_THREADS": num_threads})
+                mallocs = count_allocations(compiled_tokenizer, batch, args.repeat)
+                print(f"{batch_size:>8} {num_threads:>8} {mallocs:>26.1f}")
+        return
+
+    print(f"{'batch':>8} {'threads':>8} {'latency, ms':>12} {'speedup':>8}")
+    for batch_size in args.batch_size:
+        batch = make_batch(batch_size)
+        reference_time, reference_output = None, None
+
+        for num_threads in args.threads:
+            compiled_tokenizer = core.compile_model(ov_tokenizer, "CPU", {"INFERENCE_NUM_THREADS": num_threads})
+            elapsed, output = run(compiled_tokenizer, batch, args.repeat)
+
+            if reference_output is None:
+                reference_time, reference_output = elapsed, output
+            # parallel evaluation must not change the result
+            for name, value in reference_output.items():
+                assert np.array_equal(value, output[name]), f"Output {name} differs for {num_threads} threads"
+
+            print(f"{batch_size:>8} {num_threads:>8} {elapsed * 1000:>12.3f} {reference_time / elapsed:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -2,10 +2,23 @@
 # Copyright (C) 2018-2023 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
+import json
+from itertools import product
+from string import ascii_lowercase
+
 import numpy as np
 import pytest
-from openvino import Core
-from openvino_tokenizers import convert_tokenizer
+from openvino import AsyncInferQueue, Core, Model, PartialShape, Type
+from openvino.runtime import op, serialize
+from openvino.runtime.exceptions import OVTypeError
+from openvino_tokenizers import IncrementalDetokenizer, _get_factory, convert_tokenizer, fuse_regex_normalizations
+from openvino_tokenizers.tokenizer_pipeline import (
+    BPETokenizationStep,
+    RegexNormalizationStep,
+    RegexSplitStep,
+    TokenizerPipeline,
+)
+from tokenizers import Tokenizer
 from transformers import AutoTokenizer
 
 
@@ -468,3 +481,285 @@ def test_detokenizer_results_align_with_hf_on_multitoken_symbols_for_streaming()
         hf_detokenized_stream += hf_output
 
     assert detokenized_stream == hf_detokenized_stream
+
+
+@pytest.mark.parametrize("test_string", ["this is a test string", *emoji_test_strings, *multilingual_test_strings[:4]])
+def test_incremental_detokenizer(hf_tokenizers_for_streaming, test_string):
+    hf_tokenizer = hf_tokenizers_for_streaming
+    # cleaning up tokenization spaces depends on the next tokens, so it is not supported for incremental decoding
+    _, ov_detokenizer = convert_tokenizer(
+        hf_tokenizer, with_detokenizer=True, streaming_detokenizer=True, clean_up_tokenization_spaces=False
+    )
+    incremental_detokenizer = IncrementalDetokenizer(ov_detokenizer)
+
+    tokenized_string = hf_tokenizer(test_string).input_ids
+    hf_detokenized = hf_tokenizer.decode(tokenized_string, clean_up_tokenization_spaces=False)
+
+    # every step gets only one new token and returns only complete characters
+    detokenized_stream = ""
+    for token in tokenized_string:
+        detokenized_stream += incremental_detokenizer.step(np.array([[token]]))[0]
+    detokenized_stream += incremental_detokenizer.flush()[0]
+
+    assert detokenized_stream == hf_detokenized
+
+
+@pytest.mark.parametrize(
+    "streaming_detokenizer, clean_up_tokenization_spaces",
+    [(False, False), (True, True)],
+    ids=["no_streaming_detokenizer", "clean_spaces"],
+)
+def test_incremental_detokenizer_rejects_context_dependent_decoding(
+    hf_tokenizers_for_streaming, streaming_detokenizer, clean_up_tokenization_spaces
+):
+    _, ov_detokenizer = convert_tokenizer(
+        hf_tokenizers_for_streaming,
+        with_detokenizer=True,
+        streaming_detokenizer=streaming_detokenizer,
+        clean_up_tokenization_spaces=clean_up_tokenization_spaces,
+    )
+    with pytest.raises(OVTypeError):
+        IncrementalDetokenizer(ov_detokenizer)
+
+
+def build_normalization_model(steps) -> Model:
+    string_input = op.Parameter(Type.string, PartialShape(["?"]))
+    outputs = _get_factory().create("StringTensorUnpack", string_input.outputs()).outputs()
+    for step in steps:
+        outputs = step.get_ov_subgraph(outputs)
+    outputs = _get_factory().create("StringTensorPack", outputs).outputs()
+    return Model(outputs, [string_input])
+
+
+def test_regex_normalizations_fusion():
+    steps = [
+        RegexNormalizationStep.strip_accents_regex(),
+        RegexNormalizationStep(regex_search_pattern=r"\s+", replace_term=" "),
+        RegexNormalizationStep.add_prefix_whitespace_regex(),
+        RegexNormalizationStep(regex_search_pattern=r"(\d)", replace_term=r"<\1>"),
+    ]
+    fused_model = fuse_regex_normalizations(build_normalization_model(steps))
+    fused_types = [node.get_type_name() for node in fused_model.get_ordered_ops()]
+    assert fused_types.count("RegexNormalization") == 1
+
+    test_strings = eng_test_strings + multilingual_test_strings + ["", "Tester, la chaîne...\t\t0987"]
+    reference = core.compile_model(build_normalization_model(steps))([test_strings])[0]
+    fused = core.compile_model(fused_model)([test_strings])[0]
+    assert list(fused) == list(reference)
+
+
+def build_split_model(step) -> Model:
+    string_input = op.Parameter(Type.string, PartialShape(["?"]))
+    outputs = _get_factory().create("StringTensorUnpack", string_input.outputs()).outputs()
+    outputs = step.get_ov_subgraph(TokenizerPipeline.add_ragged_dimension(outputs))
+    # drop the ragged dimension, splits of all the strings go to the single output
+    outputs = _get_factory().create("StringTensorPack", outputs[2:]).outputs()
+    return Model(outputs, [string_input])
+
+
+@pytest.mark.parametrize(
+    "behaviour, invert, expected",
+    [
+        ("remove", False, ["Hello,", "world!", "Hello"]),
+        ("isolate", False, ["Hello,", " ", " ", "world!", "Hello"]),
+        ("contiguous", False, ["Hello,", "  ", "world!", "Hello"]),
+        ("merge_with_previous", False, ["Hello, ", " ", "world!", "Hello"]),
+        ("merge_with_next", False, ["Hello,", " ", " world!", "Hello"]),
+        ("remove", True, [" ", " "]),
+        ("isolate", True, ["Hello,", " ", " ", "world!", "Hello"]),
+        ("contiguous", True, ["Hello,", "  ", "world!", "Hello"]),
+        ("merge_with_previous", True, ["Hello,", " ", " world!", "Hello"]),
+        ("merge_with_next", True, ["Hello, ", " ", "world!", "Hello"]),
+    ],
+)
+def test_regex_split_modes(behaviour, invert, expected):
+    # the second string has no matches and goes through the prefilter path
+    test_strings = ["Hello,  world!", "Hello", ""]
+    step = RegexSplitStep(split_pattern=" ", invert=invert, behaviour=behaviour)
+    splits = core.compile_model(build_split_model(step))([test_strings])[0]
+    assert list(splits) == expected
+
+
+# every pre-tokenized word of the string is unique: "aa", " ab", " ac", ...
+distinct_words_string = " ".join("".join(letters) for letters in product(ascii_lowercase, repeat=2))
+
+
+@pytest.fixture(scope="session")
+def hf_gpt2_tokenizer():
+    return AutoTokenizer.from_pretrained("gpt2")
+
+
+def get_bpe_tokenizer_node(model):
+    return next(node for node in model.get_ordered_ops() if node.get_type_name() == "BPETokenizer")
+
+
+def convert_with_cache_capacity(hf_tokenizer, cache_capacity):
+    ov_tokenizer = convert_tokenizer(hf_tokenizer, with_detokenizer=False)
+    node = get_bpe_tokenizer_node(ov_tokenizer)
+    attributes = {**node.get_attributes(), "cache_capacity": cache_capacity}
+    new_node = _get_factory().create("BPETokenizer", node.input_values(), attributes)
+    for output, new_output in zip(node.outputs(), new_node.outputs()):
+        output.replace(new_output)
+    return ov_tokenizer
+
+
+def get_cache_statistics(model):
+    # runtime info prints the current values as "size=<words> hits=<lookups> misses=<lookups>"
+    statistics = get_bpe_tokenizer_node(model).get_rt_info()["token_cache_statistics"].astype(str)
+    statistics = dict(item.split("=") for item in statistics.split())
+    return int(statistics["size"]), int(statistics["hits"]), int(statistics["misses"])
+
+
+def test_bpe_cache_statistics_are_not_serialized(hf_gpt2_tokenizer, tmp_path):
+    ov_tokenizer = convert_tokenizer(hf_gpt2_tokenizer, with_detokenizer=False)
+    assert "cache_hits" not in get_bpe_tokenizer_node(ov_tokenizer).get_attributes()
+
+    serialize(ov_tokenizer, tmp_path / "before.xml")
+    core.compile_model(ov_tokenizer)([distinct_words_string])
+    assert get_cache_statistics(ov_tokenizer)[2] > 0
+    serialize(ov_tokenizer, tmp_path / "after.xml")
+    assert (tmp_path / "before.xml").read_text() == (tmp_path / "after.xml").read_text()
+
+
+def num_words(hf_tokenizer, test_string):
+    return len(hf_tokenizer.backend_tokenizer.pre_tokenizer.pre_tokenize_str(test_string))
+
+
+def test_bpe_cache_is_shared_between_clones(hf_gpt2_tokenizer):
+    ov_tokenizer = convert_tokenizer(hf_gpt2_tokenizer, with_detokenizer=False)
+    words = num_words(hf_gpt2_tokenizer, distinct_words_string)
+    hf_input_ids = hf_gpt2_tokenizer([distinct_words_string], return_tensors="np").input_ids
+
+    first = core.compile_model(ov_tokenizer)
+    assert np.all(first([distinct_words_string])["input_ids"] == hf_input_ids)
+    assert get_cache_statistics(ov_tokenizer) == (words, 0, words)
+
+    # the second compiled model clones the same node and finds all the words in the cache
+    second = core.compile_model(ov_tokenizer)
+    assert np.all(second([distinct_words_string])["input_ids"] == hf_input_ids)
+    assert get_cache_statistics(ov_tokenizer) == (words, words, words)
+
+
+def test_bpe_cache_disabled_with_zero_capacity(hf_gpt2_tokenizer):
+    ov_tokenizer = convert_with_cache_capacity(hf_gpt2_tokenizer, cache_capacity=0)
+    compiled_tokenizer = core.compile_model(ov_tokenizer)
+    hf_input_ids = hf_gpt2_tokenizer([distinct_words_string], return_tensors="np").input_ids
+
+    for _ in range(2):
+        assert np.all(compiled_tokenizer([distinct_words_string])["input_ids"] == hf_input_ids)
+    assert get_cache_statistics(ov_tokenizer) == (0, 0, 0)
+
+
+def test_bpe_cache_keeps_first_words_at_capacity(hf_gpt2_tokenizer):
+    cache_capacity = 100
+    ov_tokenizer = convert_with_cache_capacity(hf_gpt2_tokenizer, cache_capacity=cache_capacity)
+    compiled_tokenizer = core.compile_model(ov_tokenizer)
+    words = num_words(hf_gpt2_tokenizer, distinct_words_string)
+    hf_input_ids = hf_gpt2_tokenizer([distinct_words_string], return_tensors="np").input_ids
+    assert words > cache_capacity
+
+    assert np.all(compiled_tokenizer([distinct_words_string])["input_ids"] == hf_input_ids)
+    assert get_cache_statistics(ov_tokenizer) == (cache_capacity, 0, words)
+
+    # words that came after the cache was full are not stored and miss again
+    assert np.all(compiled_tokenizer([distinct_words_string])["input_ids"] == hf_input_ids)
+    assert get_cache_statistics(ov_tokenizer) == (cache_capacity, cache_capacity, 2 * words - cache_capacity)
+
+
+def test_bpe_cache_concurrent_lookup_and_insert(hf_gpt2_tokenizer):
+    ov_tokenizer = convert_with_cache_capacity(hf_gpt2_tokenizer, cache_capacity=1000)
+    compiled_tokenizer = core.compile_model(ov_tokenizer, "CPU", {"PERFORMANCE_HINT": "THROUGHPUT"})
+
+    # rows are tokenized in parallel and share most of the words, so the same shards are read and written at once
+    test_strings = [distinct_words_string[offset:] for offset in range(0, 600, 3)]
+    words = sum(num_words(hf_gpt2_tokenizer, test_string) for test_string in test_strings)
+    hf_input_ids = [hf_gpt2_tokenizer(test_string).input_ids for test_string in test_strings]
+
+    num_requests = 8
+    infer_queue = AsyncInferQueue(compiled_tokenizer, 4)
+    results = []
+    infer_queue.set_callback(
+        lambda request, _: results.append(
+            (request.get_tensor("input_ids").data.copy(), request.get_tensor("attention_mask").data.copy())
+        )
+    )
+    for _ in range(num_requests):
+        infer_queue.start_async([test_strings])
+    infer_queue.wait_all()
+
+    assert len(results) == num_requests
+    for ov_input_ids, ov_attention_mask in results:
+        for row, hf_row in enumerate(hf_input_ids):
+            assert list(ov_input_ids[row][ov_attention_mask[row] == 1]) == hf_row
+    # a word missed by several rows at once is stored only once
+    size, hits, misses = get_cache_statistics(ov_tokenizer)
+    assert size == num_words(hf_gpt2_tokenizer, distinct_words_string)
+    assert hits + misses == num_requests * words
+
+
+long_word_strings = [
+    "a" * 500,
+    "supercalifragilisticexpialidocious" * 20,
+    "Тестоваястрока" * 40,
+    "😀" * 100,
+]
+
+
+def get_bpe_words(hf_tokenizer, test_string):
+    backend = hf_tokenizer.backend_tokenizer
+    if backend.normalizer is not None:
+        test_string = backend.normalizer.normalize_str(test_string)
+    if backend.pre_tokenizer is None:
+        return [test_string]
+    return [word for word, _ in backend.pre_tokenizer.pre_tokenize_str(test_string)]
+
+
+@pytest.fixture(
+    scope="session",
+    params=[
+        ("gpt2", {}),
+        ("NousResearch/Llama-2-13b-hf", {}),  # byte fallback
+        ("NousResearch/Llama-2-13b-hf", {"byte_fallback": False}),  # fused unk tokens
+        ("laion/CLIP-ViT-bigG-14-laion2B-39B-b160k", {}),  # end suffix
+    ],
+    ids=lambda param: "-".join([param[0].split("/")[-1], *(f"{key}={value}" for key, value in param[1].items())]),
+)
+def bpe_models_parity(request):
+    checkpoint, model_overrides = request.param
+    hf_tokenizer = AutoTokenizer.from_pretrained(checkpoint)
+    tokenizer_json = json.loads(hf_tokenizer.backend_tokenizer.to_str())
+    tokenizer_json["model"].update(model_overrides)
+    reference_model = Tokenizer.from_str(json.dumps(tokenizer_json)).model
+
+    # every word is a separate row, so the ragged output has the tokens of one word per row
+    pipeline = TokenizerPipeline()
+    pipeline.add_steps(BPETokenizationStep.from_hf_json(tokenizer_json))
+    string_input = op.Parameter(Type.string, PartialShape(["?"]))
+    outputs = _get_factory().create("StringTensorUnpack", string_input.outputs()).outputs()
+    outputs = pipeline[0].get_ov_subgraph(TokenizerPipeline.add_ragged_dimension(outputs))
+    ov_model = core.compile_model(Model(outputs, [string_input]))
+    return hf_tokenizer, reference_model, ov_model
+
+
+@pytest.mark.parametrize(
+    "test_string",
+    [
+        *eng_test_strings,
+        *multilingual_test_strings,
+        *emoji_test_strings,
+        *misc_strings,
+        *long_word_strings,
+    ],
+)
+def test_bpe_model_parity(bpe_models_parity, test_string):
+    hf_tokenizer, reference_model, ov_model = bpe_models_parity
+    words = [word for word in get_bpe_words(hf_tokenizer, test_string) if word]
+    if not words:
+        pytest.skip("String has no words to tokenize")
+
+    reference = [[token.id for token in reference_model.tokenize(word)] for word in words]
+    # the second run takes the words from the cache
+    for _ in range(2):
+        begins, ends, token_ids = ov_model([words]).values()
+        ov_result = [list(token_ids[begin:end]) for begin, end in zip(begins, ends)]
+        assert ov_result == reference
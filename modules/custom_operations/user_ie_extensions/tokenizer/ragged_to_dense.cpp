@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
+
 #include <openvino/op/constant.hpp>
+#include "openvino/core/parallel.hpp"
 
 #include "ragged_to_dense.hpp"
 #include "utils.hpp"
@@ -50,7 +53,6 @@ void RaggedToDense::validate_and_infer_types() {
 
 bool RaggedToDense::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
     // FIXME: Works for POD types only (not for strings!)
-    // FIXME: Output mask is calculated even if there are no consumers
     auto begins = inputs[0].data<const int32_t>();
     auto ends   = inputs[1].data<const int32_t>();
     auto nelems = inputs[0].get_size();
@@ -65,24 +67,19 @@ bool RaggedToDense::evaluate(ov::TensorVector& outputs, const ov::TensorVector&
     auto out_elems = reinterpret_cast<char*>(outputs[0].data());
     auto out_mask = outputs[1].data<char>();
 
-    auto out_elem_orig = out_elems;
-    auto out_mask_orig = out_mask;
-
-    for(size_t i = 0; i < nelems; ++i) {
-        auto begin = elems + elem_size*begins[i];
+    // every row has its fixed place in the dense output, so rows are independent
+    ov::parallel_for(nelems, [&](size_t i) {
+        auto row_elems = out_elems + elem_size*target_dim*i;
         auto len = std::min(size_t(ends[i] - begins[i]), target_dim);  // truncation
-        auto end = begin + elem_size*len;
-        out_elems = std::copy(begin, end, out_elems);
-        out_mask = std::fill_n(out_mask, len, char(1));
-        if(len < target_dim)
-            out_mask = std::fill_n(out_mask, target_dim - len, char(0));
-        while(len < target_dim) {
-            out_elems = std::copy(default_value, default_value + elem_size, out_elems);
-            ++len;
-        }
-    }
+        std::memcpy(row_elems, elems + elem_size*begins[i], elem_size*len);
+        fill_elements(row_elems + elem_size*len, target_dim - len, default_value, elem_size);
+
+        auto row_mask = out_mask + target_dim*i;
+        std::fill_n(row_mask, len, char(1));
+        std::fill_n(row_mask + len, target_dim - len, char(0));
+    });
 
-    OPENVINO_ASSERT(out_elems == out_elem_orig + outputs[0].get_byte_size());
-    OPENVINO_ASSERT(out_mask == out_mask_orig + outputs[1].get_byte_size());
+    OPENVINO_ASSERT(nelems*target_dim*elem_size == outputs[0].get_byte_size());
+    OPENVINO_ASSERT(nelems*target_dim == outputs[1].get_byte_size());
     return true;
 }
@@ -4,11 +4,46 @@
 
 
 
+#include <algorithm>
+
 #include "regex_normalization.hpp"
 #include "utils.hpp"
 
 using namespace ov;
 
+namespace {
+
+std::shared_ptr<RegexNormalization::Replacements> compile_replacements(const ov::OutputVector& arguments) {
+    auto replacements = std::make_shared<RegexNormalization::Replacements>();
+    auto pattern_set = std::make_shared<re2::RE2::Set>(re2::RE2::DefaultOptions, re2::RE2::UNANCHORED);
+
+    for (size_t i = 3; i + 1 < arguments.size(); i += 2) {
+        auto search_pattern_const = as_type_ptr<Constant>(arguments[i].get_node_shared_ptr());
+        auto replace_pattern_const = as_type_ptr<Constant>(arguments[i + 1].get_node_shared_ptr());
+        OPENVINO_ASSERT(search_pattern_const && replace_pattern_const, "RegexNormalization expects search and replace patterns to be constants");
+        auto search_pattern_buf = static_cast<const char*>(search_pattern_const->get_data_ptr());
+        auto replace_pattern_buf = static_cast<const char*>(replace_pattern_const->get_data_ptr());
+        auto search_pattern = re2::StringPiece(search_pattern_buf, search_pattern_const->get_byte_size());
+
+        auto search_pattern_re = std::make_shared<re2::RE2>(search_pattern);
+        // FIXME: if regex is not valid re2, strings are not changed by it (use another regex engine)
+        if (search_pattern_re->ok() && pattern_set->Add(search_pattern, nullptr) >= 0) {
+            replacements->pattern_set_indices.push_back(replacements->search_patterns.size());
+        }
+        replacements->prefilters.emplace_back(*search_pattern_re);
+        replacements->search_patterns.push_back(std::move(search_pattern_re));
+        replacements->replace_patterns.emplace_back(replace_pattern_buf, replace_pattern_const->get_byte_size());
+    }
+
+    // a single pattern is checked cheaper by itself
+    if (replacements->pattern_set_indices.size() > 1 && pattern_set->Compile()) {
+        replacements->pattern_set = pattern_set;
+    }
+    return replacements;
+}
+
+}  // namespace
+
 
 RegexNormalization::RegexNormalization(const ov::OutputVector& arguments) :
         ov::op::Op(arguments) {
@@ -18,17 +53,10 @@ RegexNormalization::RegexNormalization(const ov::OutputVector& arguments) :
 
 RegexNormalization::RegexNormalization(
         const ov::OutputVector& arguments,
-        const std::shared_ptr<re2::RE2>& search_pattern_re,
-        const absl::string_view replace_pattern
-    ) : ov::op::Op(arguments), m_search_pattern_re(search_pattern_re), m_replace_pattern(replace_pattern) {
-        if (m_search_pattern_re == nullptr) {
-            auto search_pattern_const = as_type_ptr<Constant>(arguments[3].get_node_shared_ptr());
-            auto replace_pattern_const = as_type_ptr<Constant>(arguments[4].get_node_shared_ptr());
-            auto search_pattern_buf = static_cast<const char*>(search_pattern_const->get_data_ptr());
-            auto replace_pattern_buf = static_cast<const char*>(replace_pattern_const->get_data_ptr());
-            auto search_pattern = absl::string_view((const char*)search_pattern_buf, search_pattern_const->get_byte_size());
-            m_replace_pattern = absl::string_view((const char*)replace_pattern_buf, replace_pattern_const->get_byte_size());
-            m_search_pattern_re = std::make_shared<re2::RE2>(search_pattern);
+        const std::shared_ptr<const Replacements>& replacements
+    ) : ov::op::Op(arguments), m_replacements(replacements) {
+        if (m_replacements == nullptr) {
+            m_replacements = compile_replacements(arguments);
         };
         constructor_validate_and_infer_types();
     }
@@ -36,22 +64,59 @@ RegexNormalization::RegexNormalization(
 
 void RegexNormalization::validate_and_infer_types() {
     check_string_input(this, 0);
-    check_string_scalar_input(this, 3);
-    check_string_scalar_input(this, 4);
+    const auto num_inputs = get_input_size();
+    OPENVINO_ASSERT(num_inputs >= 5 && (num_inputs - 3) % 2 == 0, "RegexNormalization expects pairs of search and replace patterns after the string input");
+    for (size_t i = 3; i < num_inputs; ++i) {
+        check_string_scalar_input(this, i);
+    }
     set_string_output(this, 0, get_input_partial_shape(0));
 }
 
 
 bool RegexNormalization::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    const auto& replacements = *m_replacements;
+    const auto num_patterns = replacements.search_patterns.size();
+    std::vector<int> set_matches;               // reused between elements
+    std::vector<bool> matched(num_patterns);
+
     return evaluate_normalization_helper(
         outputs, inputs,
-        [this](const std::string& str) {
-            // FIXME: if regex is not valid re2, return string without changing (use another regex engine)
-            if (m_search_pattern_re->NumberOfCapturingGroups() == -1)
-                return str;
-
-            std::string result = str;
-            re2::RE2::GlobalReplace(&result, *m_search_pattern_re, m_replace_pattern);
-            return result;
+        [&](std::string_view str, std::string& normalized) {
+            const auto text = re2::StringPiece(str.data(), str.size());
+            re2::RE2::Set::ErrorInfo set_error;
+            const bool use_set = replacements.pattern_set && replacements.pattern_set->Match(text, &set_matches, &set_error);
+            if (replacements.pattern_set && !use_set && set_error.kind == re2::RE2::Set::kNoError) {
+                // the most of the strings don't have matches, keep them as is without copying
+                return false;
+            }
+            if (use_set) {
+                std::fill(matched.begin(), matched.end(), false);
+                for (auto set_index : set_matches) {
+                    matched[replacements.pattern_set_indices[set_index]] = true;
+                }
+            }
+
+            bool changed = false;
+            for (size_t i = 0; i < num_patterns; ++i) {
+                const auto& search_pattern = *replacements.search_patterns[i];
+                if (!search_pattern.ok()) {
+                    continue;
+                }
+                // the set result holds for the original string only, replaced text is checked pattern by pattern
+                const auto current = changed ? re2::StringPiece(normalized) : text;
+                const bool has_match = use_set && !changed
+                    ? matched[i]
+                    : replacements.prefilters[i].may_match(std::string_view(current.data(), current.size())) &&
+                      re2::RE2::PartialMatch(current, search_pattern);
+                if (!has_match) {
+                    continue;
+                }
+                if (!changed) {
+                    normalized.assign(str.data(), str.size());
+                    changed = true;
+                }
+                re2::RE2::GlobalReplace(&normalized, search_pattern, replacements.replace_patterns[i]);
+            }
+            return changed;
     });
 }
@@ -9,26 +9,42 @@
 #include <openvino/op/op.hpp>
 #include "openvino/opsets/opset10.hpp"
 #include "fast_tokenizer/normalizers/normalizers.h"
+#include "re2/set.h"
+
+#include "regex_prefilter.hpp"
 
 using namespace ov;
 using namespace ov::opset10;
 
+// Applies regex replacements to strings. Inputs after the decomposed string are pairs of search and replace
+// pattern constants, the replacements are applied in order. A chain of several pairs is produced by fusing
+// consecutive RegexNormalization nodes: the string is scanned once by RE2::Set of all search patterns and
+// only the matched replacements are applied.
 class RegexNormalization : public ov::op::Op {
 public:
     OPENVINO_OP("RegexNormalization");
 
+    // Compiled patterns shared between clones of the node
+    struct Replacements {
+        std::vector<std::shared_ptr<re2::RE2>> search_patterns;
+        std::vector<absl::string_view> replace_patterns;
+        std::vector<RegexPrefilter> prefilters;
+        // a set of valid search patterns for chains of two or more replacements, set indices map to the patterns
+        std::shared_ptr<re2::RE2::Set> pattern_set;
+        std::vector<size_t> pattern_set_indices;
+    };
+
     RegexNormalization () = default;
     RegexNormalization(const ov::OutputVector& arguments);  // not used
     RegexNormalization(
         const ov::OutputVector& arguments,
-        const std::shared_ptr<re2::RE2>& search_pattern_re,
-        const absl::string_view replace_pattern
+        const std::shared_ptr<const Replacements>& replacements
     );
 
     void validate_and_infer_types() override;
 
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
-        return std::make_shared<RegexNormalization>(inputs, m_search_pattern_re, m_replace_pattern);
+        return std::make_shared<RegexNormalization>(inputs, m_replacements);
     }
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override {
@@ -41,6 +57,5 @@ public:
         return true;
     }
 private:
-    std::shared_ptr<re2::RE2> m_search_pattern_re;
-    absl::string_view m_replace_pattern;
+    std::shared_ptr<const Replacements> m_replacements;
 };
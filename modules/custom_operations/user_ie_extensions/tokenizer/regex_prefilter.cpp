@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+
+#include "regex_prefilter.hpp"
+#include "utils.hpp"
+
+
+RegexPrefilter::RegexPrefilter(const re2::RE2& pattern) {
+    std::string min_match, max_match;
+    // an empty min means that the pattern can match an empty string, then every string can have a match
+    if (!pattern.ok() || !pattern.PossibleMatchRange(&min_match, &max_match, 10) || min_match.empty()) {
+        return;
+    }
+    m_first_byte_low = static_cast<uint8_t>(min_match[0]);
+    // an empty max stands for an unbounded range
+    m_first_byte_high = max_match.empty() ? 255 : static_cast<uint8_t>(max_match[0]);
+    m_enabled = m_first_byte_low <= m_first_byte_high && !(m_first_byte_low == 0 && m_first_byte_high == 255);
+}
+
+
+bool RegexPrefilter::may_match(std::string_view text) const {
+    if (!m_enabled) {
+        return true;
+    }
+    // look for the first byte out of the complement range, the range check wraps around 255
+    const auto data = reinterpret_cast<const uint8_t*>(text.data());
+    const auto outside_low = static_cast<uint8_t>(m_first_byte_high + 1);
+    const auto outside_high = static_cast<uint8_t>(m_first_byte_low - 1);
+    return leading_bytes_in_range(data, text.size(), outside_low, outside_high) < text.size();
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "fast_tokenizer/normalizers/normalizers.h"
+
+// Cheap check that rejects strings without matches before running the regex engine on them.
+// Any non-empty match starts with a byte from the range given by RE2::PossibleMatchRange, so a string
+// without such bytes is skipped after a vectorized scan. Patterns that can match an empty string are not filtered.
+class RegexPrefilter {
+public:
+    RegexPrefilter() = default;
+    explicit RegexPrefilter(const re2::RE2& pattern);
+
+    // Returns false only if the pattern has no matches in the text
+    bool may_match(std::string_view text) const;
+
+private:
+    bool m_enabled = false;
+    uint8_t m_first_byte_low = 0;
+    uint8_t m_first_byte_high = 255;
+};
@@ -14,7 +14,14 @@ using namespace ov::opset10;
 
 namespace {
 
-using paddlenlp::fast_tokenizer::core::SplitMode;
+enum class SplitMode {
+    REMOVED,
+    ISOLATED,
+    CONTIGUOUS,
+    MERGED_WITH_PREVIOUS,
+    MERGED_WITH_NEXT,
+};
+
 const std::map<std::string, SplitMode> split_modes = {
     {"remove", SplitMode::REMOVED},
     {"isolate", SplitMode::ISOLATED},
@@ -23,6 +30,89 @@ const std::map<std::string, SplitMode> split_modes = {
     {"merge_with_next", SplitMode::MERGED_WITH_NEXT},
 };
 
+// Byte range of a string that is either matched by the split pattern or lays between the matches
+struct Span {
+    size_t begin;
+    size_t end;
+    bool is_match;
+};
+
+// Covers the whole string by the spans of pattern matches and the spans between them
+void find_matches(const re2::RE2& pattern, re2::StringPiece str, bool invert, std::vector<Span>& spans) {
+    spans.clear();
+    size_t prev = 0;
+    size_t pos = 0;
+    re2::StringPiece match;
+
+    while (pos <= str.size() && pattern.Match(str, pos, str.size(), re2::RE2::UNANCHORED, &match, 1)) {
+        const size_t start = match.data() - str.data();
+        const size_t end = start + match.size();
+        if (prev != start) {
+            spans.push_back({prev, start, invert});
+        }
+        spans.push_back({start, end, !invert});
+        prev = end;
+        // step over an empty match to not find it again
+        pos = start == end ? end + (end < str.size() ? utf8_char_length(str[end]) : 1) : end;
+    }
+    if (prev != str.size()) {
+        spans.push_back({prev, str.size(), invert});
+    }
+}
+
+// Merges the spans according to the split behaviour, is_match flag of the result marks spans that should be removed
+void apply_split_mode(SplitMode mode, std::vector<Span>& spans) {
+    bool previous_match = false;
+    size_t num_spans = 0;
+
+    switch (mode) {
+    case SplitMode::REMOVED:
+        return;
+    case SplitMode::ISOLATED:
+        for (auto& span : spans) {
+            span.is_match = false;
+        }
+        return;
+    case SplitMode::CONTIGUOUS:
+        for (size_t i = 0; i < spans.size(); ++i) {
+            const auto span = spans[i];  // copy, the compacted span can overwrite it
+            if (span.is_match == previous_match && num_spans > 0) {
+                spans[num_spans - 1].end = span.end;
+            } else {
+                spans[num_spans++] = {span.begin, span.end, false};
+            }
+            previous_match = span.is_match;
+        }
+        break;
+    case SplitMode::MERGED_WITH_PREVIOUS:
+        for (size_t i = 0; i < spans.size(); ++i) {
+            const auto span = spans[i];  // copy, the compacted span can overwrite it
+            if (span.is_match && !previous_match && num_spans > 0) {
+                spans[num_spans - 1].end = span.end;
+            } else {
+                spans[num_spans++] = {span.begin, span.end, false};
+            }
+            previous_match = span.is_match;
+        }
+        break;
+    case SplitMode::MERGED_WITH_NEXT:
+        // the same as above but going from the end of the string, compacted spans are collected at the back
+        num_spans = spans.size();
+        for (size_t i = spans.size(); i > 0; --i) {
+            const auto span = spans[i - 1];
+            if (span.is_match && !previous_match && num_spans < spans.size()) {
+                spans[num_spans].begin = span.begin;
+            } else {
+                spans[--num_spans] = {span.begin, span.end, false};
+            }
+            previous_match = span.is_match;
+        }
+        spans.erase(spans.begin(), spans.begin() + num_spans);
+        return;
+    }
+    spans.resize(num_spans);
+}
+
 }
 
 
@@ -36,21 +126,22 @@ RegexSplit::RegexSplit(const ov::OutputVector& arguments, const std::string& beh
 
 RegexSplit::RegexSplit(
     const ov::OutputVector& arguments,
-    const std::shared_ptr<pretokenizers::SplitPreTokenizer>& pretokenizer,
+    const std::shared_ptr<re2::RE2>& search_pattern_re,
     const std::string& behaviour,
     bool invert
 ) :
     ov::op::Op(arguments),
-    m_pretokenizer(pretokenizer),
+    m_search_pattern_re(search_pattern_re),
     m_behaviour(behaviour),
     m_invert(invert) {
 
-    if (m_pretokenizer == nullptr) {
+    if (m_search_pattern_re == nullptr) {
         auto split_pattern_const = as_type_ptr<Constant>(arguments[5].get_node_shared_ptr());
         auto split_pattern_buf = static_cast<const char*>(split_pattern_const->get_data_ptr());
-        auto split_pattern = std::string(split_pattern_buf, split_pattern_const->get_byte_size());
-        m_pretokenizer = std::make_shared<pretokenizers::SplitPreTokenizer>(split_pattern, split_modes.at(behaviour), invert);
+        auto split_pattern = re2::StringPiece(split_pattern_buf, split_pattern_const->get_byte_size());
+        m_search_pattern_re = std::make_shared<re2::RE2>(split_pattern);
     };
+    m_prefilter = RegexPrefilter(*m_search_pattern_re);
 
     constructor_validate_and_infer_types();
 }
@@ -68,9 +159,8 @@ bool RegexSplit::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
     auto ragged_ends   = inputs[1].data<const int32_t>();
     auto begins = inputs[2].data<const int32_t>();
     auto ends   = inputs[3].data<const int32_t>();
-    auto chars  = inputs[4].data<const uint8_t>();
+    auto chars  = reinterpret_cast<const char*>(inputs[4].data<const uint8_t>());
 
-    outputs[4] = inputs[4];
     const size_t num_rows = inputs[0].get_size();
     const size_t num_chars = inputs[4].get_size();
 
@@ -89,21 +179,30 @@ bool RegexSplit::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inp
     auto new_ends   = outputs[3].data<int32_t>();
     int32_t ragged_offset = 0;
 
+    const auto split_mode = split_modes.at(m_behaviour);
+    std::vector<Span> spans;    // reused between the words
+
     for(size_t seq = 0; seq < num_rows; ++seq) {
         new_ragged_begins[seq] = ragged_offset;
 
         for(size_t ragged_col = ragged_begins[seq]; ragged_col < ragged_ends[seq]; ++ragged_col) {
-            auto str = std::string(chars + begins[ragged_col], chars + ends[ragged_col]);
-            paddlenlp::fast_tokenizer::pretokenizers::PreTokenizedString pretokenized(str);
-            (*m_pretokenizer)(&pretokenized);
-            size_t num_splits = pretokenized.GetSplitsSize();
-
-            for (size_t j = 0; j < num_splits; ++j) {
-                auto split = pretokenized.GetSplit(j);
-                const auto& value = split.normalized_.GetStr();
-                auto offset = split.normalized_.GetOrginalOffset();
-                new_begins[ragged_offset] = begins[ragged_col] + offset.first;
-                new_ends[ragged_offset++] = begins[ragged_col] + offset.second;
+            // words are matched in place, splits are byte ranges of the same chars tensor
+            auto str = re2::StringPiece(chars + begins[ragged_col], ends[ragged_col] - begins[ragged_col]);
+            if (m_prefilter.may_match(std::string_view(str.data(), str.size()))) {
+                find_matches(*m_search_pattern_re, str, m_invert, spans);
+            } else {
+                // the word can't contain a match, it is a single span between matches
+                spans.assign(str.empty() ? 0 : 1, {0, str.size(), m_invert});
+            }
+            apply_split_mode(split_mode, spans);
+
+            for (const auto& span : spans) {
+                // removed and empty splits don't go to the output
+                if (span.is_match || span.begin == span.end) {
+                    continue;
+                }
+                new_begins[ragged_offset] = begins[ragged_col] + span.begin;
+                new_ends[ragged_offset++] = begins[ragged_col] + span.end;
             };
         }
 
@@ -6,10 +6,11 @@
 
 #include <openvino/op/op.hpp>
 #include "openvino/opsets/opset10.hpp"
-#include "fast_tokenizer/pretokenizers/pretokenizers.h"
+#include "fast_tokenizer/normalizers/normalizers.h"   // for re2::RE2
+
+#include "regex_prefilter.hpp"
 
 using namespace ov;
-using namespace paddlenlp::fast_tokenizer;
 
 
 class RegexSplit : public ov::op::Op {
@@ -20,7 +21,7 @@ public:
     RegexSplit(const ov::OutputVector& arguments, const std::string& behaviour = "remove", bool invert = false);
     RegexSplit(
         const ov::OutputVector& arguments,
-        const std::shared_ptr<pretokenizers::SplitPreTokenizer>& pretokenizer,
+        const std::shared_ptr<re2::RE2>& search_pattern_re,
         const std::string& behaviour = "remove",
         bool invert = false
     );
@@ -28,7 +29,7 @@ public:
     void validate_and_infer_types() override;
 
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
-        return std::make_shared<RegexSplit>(inputs, m_pretokenizer, m_behaviour, m_invert);
+        return std::make_shared<RegexSplit>(inputs, m_search_pattern_re, m_behaviour, m_invert);
     }
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override {
@@ -44,7 +45,8 @@ public:
     }
 
 private:
-    std::shared_ptr<pretokenizers::SplitPreTokenizer> m_pretokenizer;
+    std::shared_ptr<re2::RE2> m_search_pattern_re;
+    RegexPrefilter m_prefilter;
     std::string m_behaviour = "remove";
     bool m_invert = false;
 };
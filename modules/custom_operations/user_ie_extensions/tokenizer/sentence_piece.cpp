@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <array>
 #include <functional>
 
 #include "normalizer.h"
 #include "model_interface.h"
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset10.hpp"
 
@@ -23,9 +25,9 @@ using namespace ov::opset10;
 // TODO: Replace shape_size(t.get_shape()) by t.get_size(), where t is ov::Tensor
 
 SentencepieceTokenizer::SentencepieceTokenizer(const OutputVector& args, int32_t nbest_size, float alpha,
-    bool add_bos, bool add_eos, bool reverse) : m_sp(std::make_shared<SentencePieceProcessor>()),
+    bool add_bos, bool add_eos, bool reverse, bool ragged_output) : m_sp(std::make_shared<SentencePieceProcessor>()),
     m_nbest_size(nbest_size), m_alpha(alpha), m_add_bos(add_bos), m_add_eos(add_eos),
-    m_reverse(reverse), Op(args) {
+    m_reverse(reverse), m_ragged_output(ragged_output), Op(args) {
     auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
     FRONT_END_GENERAL_CHECK(sp_model_const, "SentencepieceTokenizer expects SentencePiece model to be constant.");
     auto spm_model = static_cast<const char*>(sp_model_const->get_data_ptr());
@@ -56,10 +58,10 @@ SentencepieceTokenizer::SentencepieceTokenizer(const OutputVector& args, int32_t
 }
 
 SentencepieceTokenizer::SentencepieceTokenizer(const OutputVector& args, const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp,
-    int32_t nbest_size, float alpha, bool add_bos, bool add_eos, bool reverse) :
+    int32_t nbest_size, float alpha, bool add_bos, bool add_eos, bool reverse, bool ragged_output) :
     m_sp((sp == nullptr) ? std::make_shared<SentencePieceProcessor>(): sp),
     m_nbest_size(nbest_size), m_alpha(alpha), m_add_bos(add_bos), m_add_eos(add_eos),
-    m_reverse(reverse), Op(args) {
+    m_reverse(reverse), m_ragged_output(ragged_output), Op(args) {
     // constructor above without sp argument never called when the node is created with python factory, so need to init and cache m_sp here
     if (!m_sp->status().ok()) {
         auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
@@ -107,11 +109,16 @@ void SentencepieceTokenizer::validate_and_infer_types() {
         OPENVINO_THROW("Unexpected input format. SentencepieceTokenizer accepts one string input or three decomposed string inputs (begins, ends, symbols)");
     };
 
-    // The operation SentencepieceTokenizerExtensionOp has three outputs: sparse indices, sparse values
-    // and dense shape
-    set_output_type(0, element::i64, PartialShape{ Dimension(), Dimension(2) });
-    set_output_type(1, element::i32, PartialShape{ Dimension() });
-    set_output_type(2, element::i64, PartialShape{ Dimension(2) });
+    if (m_ragged_output) {
+        // Ragged output mode produces ragged begins, ends and token ids that can go directly to RaggedToDense
+        set_ragged_output(this, 0, get_input_partial_shape(1), element::i32);
+    } else {
+        // The operation SentencepieceTokenizerExtensionOp has three outputs: sparse indices, sparse values
+        // and dense shape
+        set_output_type(0, element::i64, PartialShape{ Dimension(), Dimension(2) });
+        set_output_type(1, element::i32, PartialShape{ Dimension() });
+        set_output_type(2, element::i64, PartialShape{ Dimension(2) });
+    }
 }
 
 bool SentencepieceTokenizer::visit_attributes(AttributeVisitor& visitor) {
@@ -120,42 +127,40 @@ bool SentencepieceTokenizer::visit_attributes(AttributeVisitor& visitor) {
     visitor.on_attribute("add_bos", m_add_bos);
     visitor.on_attribute("add_eos", m_add_eos);
     visitor.on_attribute("reverse", m_reverse);
+    visitor.on_attribute("ragged_output", m_ragged_output);
     return true;
 }
 
 bool SentencepieceTokenizer::evaluate(TensorVector& outputs, const TensorVector& inputs) const {
-    std::vector<int64_t> sparse_indices;
-    std::vector<int32_t> sparse_values;
-    std::vector<int64_t> sparse_dense_shape;
-
     auto input_size = get_input_size();
-    int32_t batch_size;
+    size_t batch_size;
 
     // used in case of string tensors
-    const std::string* strings;
+    const std::string* strings = nullptr;
 
     // used in case of u8 packed representation
-    const int32_t* begin_ids;
-    const int32_t* end_ids;
-    const uint8_t* data;
+    const int32_t* begin_ids = nullptr;
+    const int32_t* end_ids = nullptr;
+    const uint8_t* data = nullptr;
 
     if (input_size == 2) {
         auto input_element_type = get_input_element_type(1);
         if(input_element_type == ov::element::string) {
             strings = inputs[1].data<const std::string>();
-            batch_size = static_cast<int32_t>(ov::shape_size(inputs[1].get_shape()));
+            batch_size = inputs[1].get_size();
         } else {
             OPENVINO_THROW("Unexpected input type during inference. SentencepieceTokenizer accepts element::u8 or element::string.");
         }
     } else {
-        auto begin_ids = inputs[1].data<const int32_t>();
-        auto end_ids = inputs[2].data<const int32_t>();
-        auto data = inputs[3].data<const uint8_t>();
-        batch_size = shape_size(inputs[1].get_shape());
+        begin_ids = inputs[1].data<const int32_t>();
+        end_ids = inputs[2].data<const int32_t>();
+        data = inputs[3].data<const uint8_t>();
+        batch_size = inputs[1].get_size();
     };
 
-    size_t max_token_id = 0;
-    for (size_t batch_ind = 0; batch_ind < batch_size; ++batch_ind) {
+    // Encode sentences independently, token ids are placed to the outputs when all the lengths are known
+    std::vector<std::vector<int32_t>> ids(batch_size);
+    auto encode = [&](size_t batch_ind) {
         absl::string_view sentence;
         if (input_size == 2) {
             sentence = strings[batch_ind];
@@ -164,26 +169,62 @@ bool SentencepieceTokenizer::evaluate(TensorVector& outputs, const TensorVector&
             auto end_ind = end_ids[batch_ind];
             sentence = absl::string_view((const char*)data + begin_ind, end_ind - begin_ind);
         };
-
-        std::vector<int32_t> ids;
-        CHECK_OK(m_sp->SampleEncode(sentence, m_nbest_size, m_alpha, &ids));
-        // put into resulted vectors
-        for (size_t token_id = 0; token_id < ids.size(); ++token_id) {
-            sparse_indices.push_back(static_cast<int64_t>(batch_ind));
-            sparse_indices.push_back(static_cast<int64_t>(token_id));
-            sparse_values.push_back(static_cast<int32_t>(ids[token_id]));
+        CHECK_OK(m_sp->SampleEncode(sentence, m_nbest_size, m_alpha, &ids[batch_ind]));
+    };
+    // SampleEncode is const, but sampling shares the random generator and stays sequential. Unigram models take
+    // the best encoding with nbest_size 0 or 1, other models (BPE) ignore nbest_size and apply dropout with nonzero alpha
+    const bool is_unigram = m_sp->model_proto().trainer_spec().model_type() == sentencepiece::TrainerSpec::UNIGRAM;
+    const bool is_deterministic = is_unigram ? m_nbest_size == 0 || m_nbest_size == 1 : m_alpha == 0.0f;
+    if (is_deterministic) {
+        ov::parallel_for(batch_size, encode);
+    } else {
+        for (size_t batch_ind = 0; batch_ind < batch_size; ++batch_ind) {
+            encode(batch_ind);
         }
-        max_token_id = max_token_id < ids.size() ? ids.size() : max_token_id;
     }
-    sparse_dense_shape.push_back(static_cast<int64_t>(batch_size));
-    sparse_dense_shape.push_back(static_cast<int64_t>(max_token_id));
 
-    outputs[0].set_shape({ sparse_indices.size() / 2, 2 });
-    memcpy(outputs[0].data(), sparse_indices.data(), sizeof(int64_t) * sparse_indices.size());
-    outputs[1].set_shape({ sparse_values.size() });
-    memcpy(outputs[1].data(), sparse_values.data(), sizeof(int32_t) * sparse_values.size());
+    std::vector<size_t> offsets(batch_size + 1, 0);
+    size_t max_token_id = 0;
+    for (size_t batch_ind = 0; batch_ind < batch_size; ++batch_ind) {
+        offsets[batch_ind + 1] = offsets[batch_ind] + ids[batch_ind].size();
+        max_token_id = std::max(max_token_id, ids[batch_ind].size());
+    }
+    const size_t num_tokens = offsets[batch_size];
+
+    if (m_ragged_output) {
+        outputs[0].set_shape({ batch_size });
+        outputs[1].set_shape({ batch_size });
+        outputs[2].set_shape({ num_tokens });
+        auto ragged_begins = outputs[0].data<int32_t>();
+        auto ragged_ends = outputs[1].data<int32_t>();
+        auto values = outputs[2].data<int32_t>();
+
+        ov::parallel_for(batch_size, [&](size_t batch_ind) {
+            ragged_begins[batch_ind] = static_cast<int32_t>(offsets[batch_ind]);
+            ragged_ends[batch_ind] = static_cast<int32_t>(offsets[batch_ind + 1]);
+            std::copy(ids[batch_ind].begin(), ids[batch_ind].end(), values + offsets[batch_ind]);
+        });
+        return true;
+    }
+
+    outputs[0].set_shape({ num_tokens, 2 });
+    outputs[1].set_shape({ num_tokens });
     outputs[2].set_shape({ 2 });
-    memcpy(outputs[2].data(), sparse_dense_shape.data(), sizeof(int64_t) * sparse_dense_shape.size());
+    auto sparse_indices = outputs[0].data<int64_t>();
+    auto sparse_values = outputs[1].data<int32_t>();
+    auto sparse_dense_shape = outputs[2].data<int64_t>();
+
+    ov::parallel_for(batch_size, [&](size_t batch_ind) {
+        const auto& sentence_ids = ids[batch_ind];
+        for (size_t token_id = 0; token_id < sentence_ids.size(); ++token_id) {
+            const auto offset = offsets[batch_ind] + token_id;
+            sparse_indices[2 * offset] = static_cast<int64_t>(batch_ind);
+            sparse_indices[2 * offset + 1] = static_cast<int64_t>(token_id);
+            sparse_values[offset] = sentence_ids[token_id];
+        }
+    });
+    sparse_dense_shape[0] = static_cast<int64_t>(batch_size);
+    sparse_dense_shape[1] = static_cast<int64_t>(max_token_id);
 
     return true;
 }
@@ -193,7 +234,7 @@ bool SentencepieceTokenizer::has_evaluate() const {
 }
 
 std::shared_ptr<Node> SentencepieceTokenizer::clone_with_new_inputs(const OutputVector& new_args) const {
-    return std::make_shared<SentencepieceTokenizer>(new_args, m_sp, m_nbest_size, m_alpha, m_add_bos, m_add_eos, m_reverse);
+    return std::make_shared<SentencepieceTokenizer>(new_args, m_sp, m_nbest_size, m_alpha, m_add_bos, m_add_eos, m_reverse, m_ragged_output);
 }
 
 
@@ -246,30 +287,32 @@ bool SentencepieceDetokenizer::evaluate(TensorVector& outputs, const TensorVecto
     auto seq_len    = inputs[1].get_shape()[1];
     auto input_data = inputs[1].data<const int32_t>();
 
+    // Decode rows first to know the exact size of the chars output
+    std::vector<std::string> detokenized(batch_size);
+    ov::parallel_for(batch_size, [&](size_t batch) {
+        const auto start = input_data + batch * seq_len;
+        const std::vector<int32_t> token_ids(start, start + seq_len);
+        CHECK_OK(m_sp->Decode(token_ids, &detokenized[batch]));
+    });
+
     outputs[0].set_shape({batch_size});
     outputs[1].set_shape({batch_size});
-    outputs[2].set_shape({batch_size * seq_len * 100});  // 100 chars - max token length
 
     auto begins = outputs[0].data<int32_t>();
     auto ends   = outputs[1].data<int32_t>();
-    auto chars  = outputs[2].data<uint8_t>();
     uint32_t char_offset = 0;
 
     for(size_t batch = 0; batch < batch_size; ++batch) {
-        auto start = batch * seq_len;
-
-        std::vector<int32_t> token_ids(seq_len);
-        std::memcpy(&token_ids[0], &input_data[start], sizeof(int32_t) * seq_len);
-
-        std::string detokenized;
-        CHECK_OK(m_sp->Decode(token_ids, &detokenized));
-        std::copy(detokenized.begin(), detokenized.end(), &chars[char_offset]);
-
         begins[batch] = char_offset;
-        char_offset += detokenized.size();
+        char_offset += detokenized[batch].size();
         ends[batch] = char_offset;
     }
+
     outputs[2].set_shape({char_offset});
+    auto chars  = outputs[2].data<uint8_t>();
+    ov::parallel_for(batch_size, [&](size_t batch) {
+        std::copy(detokenized[batch].begin(), detokenized[batch].end(), &chars[begins[batch]]);
+    });
     return true;
 }
 
@@ -284,6 +327,35 @@ std::shared_ptr<Node> SentencepieceDetokenizer::clone_with_new_inputs(const Outp
 
 // Stream Detokenizer
 
+namespace {
+
+// Every byte value, byte tokens are decoded into views of this array
+const std::array<char, 256> byte_values = [] {
+    std::array<char, 256> bytes;
+    for (size_t byte = 0; byte < bytes.size(); ++byte) {
+        bytes[byte] = static_cast<char>(byte);
+    }
+    return bytes;
+}();
+
+// Decoded bytes of each token, views point to the pieces of the SentencePiece model
+std::shared_ptr<const std::vector<std::string_view>> make_decoded_pieces(const SentencePieceProcessor& sp) {
+    auto pieces = std::make_shared<std::vector<std::string_view>>(sp.GetPieceSize());
+    for (int id = 0; id < sp.GetPieceSize(); ++id) {
+        const auto& token = sp.IdToPiece(id);
+        if(token.rfind("<") == 0 && token.rfind(">") == 5) {
+            // convert "byte tokens" into bytes
+            int ch = sentencepiece::PieceToByte(token);
+            (*pieces)[id] = std::string_view(&byte_values[uint8_t(ch)], 1);
+        } else {
+            (*pieces)[id] = std::string_view(token.data(), token.size());
+        };
+    }
+    return pieces;
+}
+
+}
+
 SentencepieceStreamDetokenizer::SentencepieceStreamDetokenizer(const OutputVector& args) :
     m_sp(std::make_shared<SentencePieceProcessor>()), Op(args) {
     auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
@@ -294,11 +366,13 @@ SentencepieceStreamDetokenizer::SentencepieceStreamDetokenizer(const OutputVecto
     // configure SentencePieceProcessor
     std::string model_proto(spm_model, spm_model_size);
     CHECK_OK(m_sp->LoadFromSerializedProto(model_proto));
+    m_pieces = make_decoded_pieces(*m_sp);
     constructor_validate_and_infer_types();
 }
 
-SentencepieceStreamDetokenizer::SentencepieceStreamDetokenizer(const OutputVector& args, const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp) :
-    m_sp((sp == nullptr) ? std::make_shared<SentencePieceProcessor>(): sp), Op(args) {
+SentencepieceStreamDetokenizer::SentencepieceStreamDetokenizer(const OutputVector& args, const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp,
+    const std::shared_ptr<const std::vector<std::string_view>>& pieces) :
+    m_sp((sp == nullptr) ? std::make_shared<SentencePieceProcessor>(): sp), m_pieces(pieces), Op(args) {
     // constructor above without sp argument never called when the node is created with python factory, so need to init and cache m_sp here
     if (!m_sp->status().ok()) {
         auto sp_model_const = as_type_ptr<Constant>(args[0].get_node_shared_ptr());
@@ -310,6 +384,9 @@ SentencepieceStreamDetokenizer::SentencepieceStreamDetokenizer(const OutputVecto
         std::string model_proto(spm_model, spm_model_size);
         CHECK_OK(m_sp->LoadFromSerializedProto(model_proto));
     };
+    if (m_pieces == nullptr) {
+        m_pieces = make_decoded_pieces(*m_sp);
+    }
     constructor_validate_and_infer_types();
 }
 
@@ -331,35 +408,45 @@ bool SentencepieceStreamDetokenizer::evaluate(TensorVector& outputs, const Tenso
     auto seq_len    = inputs[1].get_shape()[1];
     auto input_data = inputs[1].data<const int32_t>();
 
+    const auto& pieces = *m_pieces;
+    // ids out of the vocab are decoded as empty strings
+    auto decode = [&](int32_t token_id) {
+        return (0 <= token_id && size_t(token_id) < pieces.size()) ? pieces[token_id] : std::string_view();
+    };
+
     outputs[0].set_shape({batch_size});
     outputs[1].set_shape({batch_size});
-    outputs[2].set_shape({batch_size * seq_len * 100});  // 100 chars - max token length
 
     auto begins = outputs[0].data<int32_t>();
     auto ends   = outputs[1].data<int32_t>();
-    auto chars  = outputs[2].data<uint8_t>();
-    uint32_t char_offset = 0;
 
-    for(size_t batch = 0; batch < batch_size; ++batch) {
+    // First pass: exact size of each decoded row
+    ov::parallel_for(batch_size, [&](size_t batch) {
         const auto start = batch * seq_len;
-
-        begins[batch] = char_offset;
+        int32_t row_size = 0;
         for(size_t seq = start; seq < start + seq_len; ++seq) {
-            const auto token_id = input_data[seq];
-            const auto token = m_sp->IdToPiece(token_id);
-
-            if(token.rfind("<") == 0 && token.rfind(">") == 5) {
-                // convert "byte tokens" into bytes
-                int ch = sentencepiece::PieceToByte(token);
-                chars[char_offset++] = ch;
-            } else {
-                std::copy(token.begin(), token.end(), &chars[char_offset]);
-                char_offset += token.size();
-            };
+            row_size += decode(input_data[seq]).size();
         };
+        ends[batch] = row_size;
+    });
+    uint32_t char_offset = 0;
+    for(size_t batch = 0; batch < batch_size; ++batch) {
+        begins[batch] = char_offset;
+        char_offset += ends[batch];
         ends[batch] = char_offset;
     }
+
+    // Second pass: rows are filled independently
     outputs[2].set_shape({char_offset});
+    auto chars  = outputs[2].data<uint8_t>();
+    ov::parallel_for(batch_size, [&](size_t batch) {
+        const auto start = batch * seq_len;
+        auto row_chars = chars + begins[batch];
+        for(size_t seq = start; seq < start + seq_len; ++seq) {
+            const auto token = decode(input_data[seq]);
+            row_chars = std::copy(token.begin(), token.end(), row_chars);
+        };
+    });
     return true;
 }
 
@@ -368,5 +455,5 @@ bool SentencepieceStreamDetokenizer::has_evaluate() const {
 }
 
 std::shared_ptr<Node> SentencepieceStreamDetokenizer::clone_with_new_inputs(const OutputVector& new_args) const {
-    return std::make_shared<SentencepieceStreamDetokenizer>(new_args, m_sp);
+    return std::make_shared<SentencepieceStreamDetokenizer>(new_args, m_sp, m_pieces);
 }
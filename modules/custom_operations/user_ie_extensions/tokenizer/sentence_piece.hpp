@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include <openvino/op/op.hpp>
 
 namespace sentencepiece {
@@ -16,9 +18,10 @@ namespace TemplateExtension {
         OPENVINO_OP("SentencepieceTokenizer");
 
         SentencepieceTokenizer() = default;
-        SentencepieceTokenizer(const ov::OutputVector& args, int32_t nbest_size, float alpha, bool add_bos, bool add_eos, bool reverse);
+        SentencepieceTokenizer(const ov::OutputVector& args, int32_t nbest_size, float alpha, bool add_bos, bool add_eos, bool reverse,
+            bool ragged_output = false);
         SentencepieceTokenizer(const ov::OutputVector& args, const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp, int32_t nbest_size, float alpha,
-            bool add_bos, bool add_eos, bool reverse);
+            bool add_bos, bool add_eos, bool reverse, bool ragged_output = false);
 
         bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
@@ -37,6 +40,8 @@ namespace TemplateExtension {
         bool m_add_bos;
         bool m_add_eos;
         bool m_reverse;
+        // produce ragged begins, ends and token ids instead of sparse indices, values and dense shape
+        bool m_ragged_output = false;
     };
 
 
@@ -71,7 +76,8 @@ namespace TemplateExtension {
         SentencepieceStreamDetokenizer() = default;
         SentencepieceStreamDetokenizer(const ov::OutputVector& args);
         SentencepieceStreamDetokenizer(const ov::OutputVector& args,
-                                 const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp);
+                                 const std::shared_ptr<sentencepiece::SentencePieceProcessor>& sp,
+                                 const std::shared_ptr<const std::vector<std::string_view>>& pieces = nullptr);
 
         bool visit_attributes(ov::AttributeVisitor& visitor) override;
 
@@ -85,5 +91,7 @@ namespace TemplateExtension {
 
     private:
         std::shared_ptr<sentencepiece::SentencePieceProcessor> m_sp;
+        // decoded bytes of each token with byte tokens already converted, built once and shared between clones
+        std::shared_ptr<const std::vector<std::string_view>> m_pieces;
     };
 }  // namespace TemplateExtension
@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <mutex>
+
+#include "token_cache.hpp"
+
+TokenCache::TokenCache(size_t capacity) :
+    m_capacity(capacity),
+    m_shard_capacity((capacity + num_shards - 1) / num_shards) {
+    for (auto& shard : m_shards) {
+        shard.words.reserve(m_shard_capacity);
+    }
+}
+
+bool TokenCache::lookup(std::string_view word, std::vector<int32_t>& token_ids) const {
+    const auto& shard = m_shards[get_shard_index(word)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.words.find(word);
+    if (it == shard.words.end()) {
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    token_ids.insert(token_ids.end(), it->second.begin(), it->second.end());
+    shard.hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void TokenCache::insert(std::string_view word, const int32_t* token_ids, size_t num_tokens) {
+    auto& shard = m_shards[get_shard_index(word)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    if (shard.words.find(word) != shard.words.end()) {
+        return;
+    }
+    // The most frequent words come first with Zipfian text, so keep them instead of evicting.
+    // The size is reserved before the insertion, so concurrent inserts to other shards can't exceed the capacity
+    if (m_size.fetch_add(1, std::memory_order_relaxed) >= m_capacity) {
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return;
+    }
+    shard.keys.emplace_back(word);
+    shard.words.emplace(shard.keys.back(), std::vector<int32_t>(token_ids, token_ids + num_tokens));
+}
+
+size_t TokenCache::get_hits() const {
+    size_t hits = 0;
+    for (const auto& shard : m_shards) {
+        hits += shard.hits.load(std::memory_order_relaxed);
+    }
+    return hits;
+}
+
+size_t TokenCache::get_misses() const {
+    size_t misses = 0;
+    for (const auto& shard : m_shards) {
+        misses += shard.misses.load(std::memory_order_relaxed);
+    }
+    return misses;
+}
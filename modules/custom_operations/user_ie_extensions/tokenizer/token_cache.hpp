@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Concurrent word -> token ids cache shared by all clones of a tokenization node.
+// Words are distributed between independent shards by their hash, so concurrent evaluations
+// rarely touch the same lock, and lookups in the same shard only take a shared lock.
+class TokenCache {
+public:
+    explicit TokenCache(size_t capacity);
+
+    // Appends cached token ids of the word to token_ids, returns false if the word is not in the cache
+    bool lookup(std::string_view word, std::vector<int32_t>& token_ids) const;
+
+    // Stores token ids of the word, the word is dropped if the cache is already full
+    void insert(std::string_view word, const int32_t* token_ids, size_t num_tokens);
+
+    size_t get_capacity() const {
+        return m_capacity;
+    }
+
+    size_t get_size() const {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    size_t get_hits() const;
+    size_t get_misses() const;
+
+private:
+    static constexpr size_t num_shards = 64;
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        // keys point to the strings owned by the shard, so lookups don't need to copy the word
+        std::unordered_map<std::string_view, std::vector<int32_t>> words;
+        std::deque<std::string> keys;
+        // counters are kept per shard to not share a single cache line between all threads
+        mutable std::atomic<size_t> hits{0};
+        mutable std::atomic<size_t> misses{0};
+    };
+
+    static size_t get_shard_index(std::string_view word) {
+        return std::hash<std::string_view>{}(word) % num_shards;
+    }
+
+    size_t m_capacity;
+    size_t m_shard_capacity;
+    std::atomic<size_t> m_size{0};
+    std::array<Shard, num_shards> m_shards;
+};
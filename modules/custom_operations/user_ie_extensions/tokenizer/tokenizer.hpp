@@ -19,5 +19,6 @@
 #include "ragged_to_dense.hpp"
 #include "vocab_decoder.hpp"
 #include "chars_to_bytes.hpp"
+#include "utf8_stream_buffer.hpp"
 
 #include "tensorflow_translators.hpp"
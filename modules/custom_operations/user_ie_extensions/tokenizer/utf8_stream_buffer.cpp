@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "utf8_stream_buffer.hpp"
+#include "utils.hpp"
+
+using namespace ov;
+
+namespace {
+
+// Length of the incomplete UTF-8 character at the end of the text, text_at(i) returns i-th byte
+template <typename TextAt>
+size_t incomplete_tail_length(size_t size, const TextAt& text_at) {
+    for (size_t length = 1; length <= std::min(size, UTF8StreamBuffer::max_pending_bytes); ++length) {
+        const uint8_t byte = text_at(size - length);
+        if ((byte & 0xC0) == 0x80) {
+            continue;   // continuation byte, look for the first byte of the character
+        }
+        return utf8_char_length(byte) > length ? length : 0;
+    }
+    return 0;
+}
+
+}
+
+
+void UTF8StreamBuffer::validate_and_infer_types() {
+    check_string_input(this, 0);
+    OPENVINO_ASSERT(get_input_size() == 3 + 1, "UTF8StreamBuffer expects decoded strings and pending bytes as inputs");
+    OPENVINO_ASSERT(get_input_element_type(3) == element::u8, "UTF8StreamBuffer expects pending bytes of u8 type");
+    OPENVINO_ASSERT(
+        get_input_partial_shape(3).compatible(PartialShape{Dimension(), Dimension(max_pending_bytes)}),
+        "UTF8StreamBuffer expects pending bytes of shape [batch, " + std::to_string(max_pending_bytes) + "]");
+
+    set_string_output(this, 0, get_input_partial_shape(0));
+    set_output_type(3, element::u8, PartialShape{get_input_partial_shape(0)[0], Dimension(max_pending_bytes)});
+}
+
+bool UTF8StreamBuffer::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    auto begins = inputs[0].data<const int32_t>();
+    auto ends   = inputs[1].data<const int32_t>();
+    auto chars  = inputs[2].data<const uint8_t>();
+    auto pending = inputs[3].data<const uint8_t>();
+    const size_t batch_size = inputs[0].get_size();
+    OPENVINO_ASSERT(inputs[3].get_size() == batch_size * max_pending_bytes, "UTF8StreamBuffer got pending bytes for a different batch size");
+
+    // Each row is the previously pending bytes followed by the decoded text of the current step
+    std::vector<size_t> pending_sizes(batch_size);
+    std::vector<size_t> output_sizes(batch_size);
+    size_t total_size = 0;
+    for (size_t row = 0; row < batch_size; ++row) {
+        const auto row_pending = pending + row * max_pending_bytes;
+        const auto row_chars = chars + begins[row];
+        const size_t pending_size = std::find(row_pending, row_pending + max_pending_bytes, 0) - row_pending;
+        const size_t row_size = pending_size + (ends[row] - begins[row]);
+        auto text_at = [&](size_t i) {
+            return i < pending_size ? row_pending[i] : row_chars[i - pending_size];
+        };
+
+        pending_sizes[row] = pending_size;
+        output_sizes[row] = row_size - incomplete_tail_length(row_size, text_at);
+        total_size += output_sizes[row];
+    }
+
+    outputs[0].set_shape({batch_size});
+    outputs[1].set_shape({batch_size});
+    outputs[2].set_shape({total_size});
+    outputs[3].set_shape({batch_size, max_pending_bytes});
+
+    auto new_begins = outputs[0].data<int32_t>();
+    auto new_ends   = outputs[1].data<int32_t>();
+    auto new_chars  = outputs[2].data<uint8_t>();
+    auto new_pending = outputs[3].data<uint8_t>();
+    std::fill_n(new_pending, batch_size * max_pending_bytes, 0);
+    size_t char_offset = 0;
+
+    for (size_t row = 0; row < batch_size; ++row) {
+        const auto row_pending = pending + row * max_pending_bytes;
+        const auto row_chars = chars + begins[row];
+        const size_t chars_size = ends[row] - begins[row];
+        const size_t pending_size = pending_sizes[row];
+        const size_t output_size = output_sizes[row];
+
+        new_begins[row] = char_offset;
+        const auto from_pending = std::min(pending_size, output_size);
+        std::copy_n(row_pending, from_pending, new_chars + char_offset);
+        std::copy_n(row_chars, output_size - from_pending, new_chars + char_offset + from_pending);
+        char_offset += output_size;
+        new_ends[row] = char_offset;
+
+        // keep the incomplete character for the next step, it can still start in the pending bytes
+        auto row_new_pending = std::copy(row_pending + from_pending, row_pending + pending_size, new_pending + row * max_pending_bytes);
+        std::copy(row_chars + (output_size - from_pending), row_chars + chars_size, row_new_pending);
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/op.hpp>
+
+// Joins decoded text of a generation step with the bytes left from the previous step and keeps an incomplete
+// UTF-8 sequence at the end of each string for the next step. The state is a u8 tensor [batch, max_pending_bytes]
+// with the pending bytes padded by zeros, so a detokenizer can decode only newly generated ids.
+class UTF8StreamBuffer : public ov::op::Op {
+public:
+    OPENVINO_OP("UTF8StreamBuffer");
+
+    // the longest incomplete UTF-8 sequence
+    static constexpr size_t max_pending_bytes = 3;
+
+    UTF8StreamBuffer () = default;
+
+    UTF8StreamBuffer(const ov::OutputVector& arguments) :
+        ov::op::Op(arguments) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
+        return std::make_shared<UTF8StreamBuffer>(inputs);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override;
+
+    bool has_evaluate() const override {
+        return true;
+    }
+};
@@ -2,6 +2,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define TOKENIZER_USE_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+#include "openvino/core/parallel.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "utils.hpp"
@@ -173,19 +189,23 @@ ov::Output<ov::Node> post_translate_ragged_tensor_output(const OutputVector& out
     return std::make_shared<RaggedTensorPack>(outputs);
 }
 
-bool evaluate_normalization_helper (ov::TensorVector& outputs, const ov::TensorVector& inputs, std::function<std::string(const std::string&)> normalizer) {
+bool evaluate_normalization_helper (ov::TensorVector& outputs, const ov::TensorVector& inputs, std::function<bool(std::string_view, std::string&)> normalizer) {
     auto begins = inputs[0].data<const int32_t>();
     auto ends   = inputs[1].data<const int32_t>();
-    auto chars  = inputs[2].data<const uint8_t>();
+    auto chars  = reinterpret_cast<const char*>(inputs[2].data<const uint8_t>());
 
     // Set output shapes
     outputs[0].set_shape(inputs[0].get_shape());
     outputs[1].set_shape(inputs[1].get_shape());
     const size_t num_elements = inputs[0].get_size();
 
-    // TODO: How to avoid copying from this temporary buffer?
-    // TODO: It can be possible to collect output symbols directly in the output tensor memory if `normalizer` has reasonable estimation for the final size.
-    std::deque<uint8_t> buffer;
+    // Normalization rarely makes the text longer, so output symbols are collected directly in the output tensor
+    // pre-sized to the input length. Only if the estimation is exceeded, the symbols are moved to a temporary buffer.
+    const size_t estimated_size = inputs[2].get_size();
+    outputs[2].set_shape(Shape{estimated_size});
+    auto new_chars = reinterpret_cast<char*>(outputs[2].data<uint8_t>());
+    std::string overflow_buffer;
+    bool overflowed = false;
 
     // For the whole implementation below the input shapes can be ignored, we are working with the flatten representaions
     // and only number of elements in the original tensors matter
@@ -194,18 +214,78 @@ bool evaluate_normalization_helper (ov::TensorVector& outputs, const ov::TensorV
     auto new_begins = outputs[0].data<int32_t>();
     auto new_ends   = outputs[1].data<int32_t>();
 
+    std::string normalized;     // reused between elements to avoid reallocations
+    size_t offset = 0;
+
     for(size_t i = 0; i < num_elements; ++i) {
-        new_begins[i] = buffer.size();
-        std::string new_str = normalizer(std::string(chars + begins[i], chars + ends[i]));
-        buffer.insert(buffer.end(), new_str.begin(), new_str.end());
-        new_ends[i] = buffer.size();
+        auto str = std::string_view(chars + begins[i], ends[i] - begins[i]);
+        if (normalizer(str, normalized)) {
+            str = normalized;
+        }
+
+        if (!overflowed && offset + str.size() > estimated_size) {
+            overflow_buffer.assign(new_chars, offset);
+            overflowed = true;
+        }
+        if (overflowed) {
+            overflow_buffer.append(str.data(), str.size());
+        } else {
+            std::copy(str.begin(), str.end(), new_chars + offset);
+        }
+
+        new_begins[i] = offset;
+        offset += str.size();
+        new_ends[i] = offset;
     }
 
-    // Copy collected symbols to the target output tensor
+    // Fix real shape based on collected results, shrinking keeps already written symbols in place
+    outputs[2].set_shape(Shape{offset});
+    if (overflowed) {
+        std::copy(overflow_buffer.begin(), overflow_buffer.end(), outputs[2].data<uint8_t>());
+    }
+
+    return true;
+}
+
+bool evaluate_tokenization_helper (ov::TensorVector& outputs, const ov::TensorVector& inputs, std::function<void(std::string_view, std::vector<int32_t>&)> tokenizer) {
+    auto ragged_begins = inputs[0].data<const int32_t>();
+    auto ragged_ends   = inputs[1].data<const int32_t>();
+    auto begins = inputs[2].data<const int32_t>();
+    auto ends   = inputs[3].data<const int32_t>();
+    auto chars  = reinterpret_cast<const char*>(inputs[4].data<const uint8_t>());
+
+    // Set output shapes
+    outputs[0].set_shape(inputs[0].get_shape());
+    outputs[1].set_shape(inputs[1].get_shape());
+    const size_t num_rows = inputs[0].get_size();
+
+    // First pass: tokenize each row independently, the size of each row result is its number of tokens
+    std::vector<std::vector<int32_t>> row_tokens(num_rows);
+    ov::parallel_for(num_rows, [&](size_t seq) {
+        auto& tokens = row_tokens[seq];
+        for(auto ragged_col = ragged_begins[seq]; ragged_col < ragged_ends[seq]; ++ragged_col) {
+            tokenizer(std::string_view(chars + begins[ragged_col], ends[ragged_col] - begins[ragged_col]), tokens);
+        }
+    });
+
+    // Get pointers in the output tensors
+    auto new_begins = outputs[0].data<int32_t>();
+    auto new_ends   = outputs[1].data<int32_t>();
+    int32_t ragged_offset = 0;
+
+    // Prefix sum of the row sizes gives exact positions of each row in the flat output
+    for(size_t seq = 0; seq < num_rows; ++seq) {
+        new_begins[seq] = ragged_offset;
+        ragged_offset += static_cast<int32_t>(row_tokens[seq].size());
+        new_ends[seq] = ragged_offset;
+    }
 
-    outputs[2].set_shape(Shape{buffer.size()});
-    auto new_chars  = outputs[2].data<uint8_t>();
-    std::copy(buffer.begin(), buffer.end(), new_chars);
+    // Second pass: fill the flat output in place, rows don't overlap
+    outputs[2].set_shape({size_t(ragged_offset)});
+    auto new_elems = outputs[2].data<int32_t>();
+    ov::parallel_for(num_rows, [&](size_t seq) {
+        std::copy(row_tokens[seq].begin(), row_tokens[seq].end(), new_elems + new_begins[seq]);
+    });
 
     return true;
 }
@@ -221,3 +301,113 @@ std::shared_ptr<Node> string_attribute_to_constant (const ov::frontend::NodeCont
     return std::make_shared<Constant>(element::u8, Shape{value.length()}, (const void*)value.data());
     #endif
 }
+
+
+#if defined(__AVX2__) || defined(TOKENIZER_USE_SSE2)
+namespace {
+
+size_t count_trailing_zeros(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+}
+#endif
+
+// A byte x is in [low, high] when (x - low) as unsigned is not greater than (high - low),
+// vector code checks it as min(x - low, high - low) == x - low because there is no unsigned byte comparison.
+size_t leading_bytes_in_range(const uint8_t* data, size_t size, uint8_t low, uint8_t high) {
+    size_t pos = 0;
+#if defined(__AVX2__)
+    const auto low_vec = _mm256_set1_epi8(static_cast<char>(low));
+    const auto width_vec = _mm256_set1_epi8(static_cast<char>(high - low));
+    for (; pos + 32 <= size; pos += 32) {
+        const auto shifted = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)), low_vec);
+        const auto in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, width_vec), shifted);
+        const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(in_range));
+        if (mask != 0xFFFFFFFFu) {
+            return pos + count_trailing_zeros(~mask);
+        }
+    }
+#elif defined(TOKENIZER_USE_SSE2)
+    const auto low_vec = _mm_set1_epi8(static_cast<char>(low));
+    const auto width_vec = _mm_set1_epi8(static_cast<char>(high - low));
+    for (; pos + 16 <= size; pos += 16) {
+        const auto shifted = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)), low_vec);
+        const auto in_range = _mm_cmpeq_epi8(_mm_min_epu8(shifted, width_vec), shifted);
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(in_range));
+        if (mask != 0xFFFFu) {
+            return pos + count_trailing_zeros(~mask);
+        }
+    }
+#endif
+    const uint8_t width = high - low;
+    while (pos < size && static_cast<uint8_t>(data[pos] - low) <= width) {
+        ++pos;
+    }
+    return pos;
+}
+
+size_t count_bytes_in_range(const uint8_t* data, size_t size, uint8_t low, uint8_t high) {
+    size_t pos = 0;
+    size_t count = 0;
+#if defined(__AVX2__)
+    const auto low_vec = _mm256_set1_epi8(static_cast<char>(low));
+    const auto width_vec = _mm256_set1_epi8(static_cast<char>(high - low));
+    for (; pos + 32 <= size; pos += 32) {
+        const auto shifted = _mm256_sub_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos)), low_vec);
+        const auto in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, width_vec), shifted);
+        count += std::bitset<32>(static_cast<uint32_t>(_mm256_movemask_epi8(in_range))).count();
+    }
+#elif defined(TOKENIZER_USE_SSE2)
+    const auto low_vec = _mm_set1_epi8(static_cast<char>(low));
+    const auto width_vec = _mm_set1_epi8(static_cast<char>(high - low));
+    for (; pos + 16 <= size; pos += 16) {
+        const auto shifted = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos)), low_vec);
+        const auto in_range = _mm_cmpeq_epi8(_mm_min_epu8(shifted, width_vec), shifted);
+        count += std::bitset<16>(static_cast<uint32_t>(_mm_movemask_epi8(in_range))).count();
+    }
+#endif
+    const uint8_t width = high - low;
+    for (; pos < size; ++pos) {
+        count += static_cast<uint8_t>(data[pos] - low) <= width;
+    }
+    return count;
+}
+
+namespace {
+
+template <typename T>
+void fill_typed(char* dst, size_t count, const char* value) {
+    T typed_value;
+    std::memcpy(&typed_value, value, sizeof(T));
+    std::fill_n(reinterpret_cast<T*>(dst), count, typed_value);
+}
+
+}  // namespace
+
+void fill_elements(char* dst, size_t count, const char* value, size_t elem_size) {
+    switch (elem_size) {
+    case 1:
+        std::memset(dst, *value, count);
+        break;
+    case 2:
+        fill_typed<uint16_t>(dst, count, value);
+        break;
+    case 4:
+        fill_typed<uint32_t>(dst, count, value);
+        break;
+    case 8:
+        fill_typed<uint64_t>(dst, count, value);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i) {
+            dst = std::copy(value, value + elem_size, dst);
+        }
+    }
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <functional>
+#include <string_view>
 #include <openvino/runtime/tensor.hpp>
 #include <openvino/frontend/node_context.hpp>
 
@@ -62,9 +63,40 @@ ov::Output<ov::Node> post_translate_string_tensor_output(const ov::OutputVector&
 
 ov::Output<ov::Node> post_translate_ragged_tensor_output(const ov::OutputVector& outputs);
 
+// Normalizes each string of the decomposed string input (inputs 0..2). The strings are passed to `normalizer` as slices
+// of the input chars tensor; it returns false if the string is kept unchanged, otherwise it puts the result to the second argument.
+// The result is written to the output chars tensor directly while it is not longer than the input.
 bool evaluate_normalization_helper (
     ov::TensorVector& outputs,
     const ov::TensorVector& inputs,
-    std::function<std::string(const std::string&)> normalizer);
+    std::function<bool(std::string_view, std::string&)> normalizer);
+
+// Tokenizes every word of the ragged string input (inputs 0..4) with `tokenizer` that appends token ids of a single word
+// to the given vector. Words are passed as slices of the input chars tensor. Rows are processed in parallel, then their
+// sizes are prefix-summed to get exact ragged offsets, so the result is identical to the sequential row-by-row processing.
+bool evaluate_tokenization_helper (
+    ov::TensorVector& outputs,
+    const ov::TensorVector& inputs,
+    std::function<void(std::string_view, std::vector<int32_t>&)> tokenizer);
+
+// Length of the UTF-8 character starting with the given byte, invalid UTF-8 is processed byte by byte
+inline size_t utf8_char_length(uint8_t first_byte) {
+    if (first_byte < 0x80) return 1;
+    if ((first_byte >> 5) == 0x6) return 2;
+    if ((first_byte >> 4) == 0xE) return 3;
+    if ((first_byte >> 3) == 0x1E) return 4;
+    return 1;
+}
+
+// Byte scanning used by byte-level ops, vectorized with AVX2 or SSE2 when the build targets them.
+// Returns the number of leading bytes of data with values in [low, high] range.
+size_t leading_bytes_in_range(const uint8_t* data, size_t size, uint8_t low, uint8_t high);
+
+// Returns the number of bytes of data with values in [low, high] range.
+size_t count_bytes_in_range(const uint8_t* data, size_t size, uint8_t low, uint8_t high);
+
+// Fills count elements of elem_size bytes each with the value, typed for 1, 2, 4 and 8 byte elements.
+// The destination is expected to be aligned to the element size as tensor data is.
+void fill_elements(char* dst, size_t count, const char* value, size_t elem_size);
 
 std::shared_ptr<ov::Node> string_attribute_to_constant (const ov::frontend::NodeContext& node, const std::string& name);
@@ -9,10 +9,70 @@
 
 #include <algorithm>
 
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
+
 #include "vocab_decoder.hpp"
+#include "string_tensor_unpack.hpp"
 #include "utils.hpp"
 
 using namespace ov;
+using op::v0::Constant;
+
+namespace {
+
+std::vector<int32_t> make_token_lengths(
+    const int32_t* vocab_begins,
+    const int32_t* vocab_ends,
+    size_t vocab_size,
+    const std::vector<int>& skip_tokens
+) {
+    std::vector<int32_t> token_lengths(vocab_size);
+    for (size_t id = 0; id < vocab_size; ++id) {
+        token_lengths[id] = vocab_ends[id] - vocab_begins[id];
+    }
+    for (auto id : skip_tokens) {
+        if (0 <= id && size_t(id) < vocab_size) {
+            token_lengths[id] = 0;
+        }
+    }
+    return token_lengths;
+}
+
+}
+
+
+VocabDecoder::VocabDecoder(
+    const ov::OutputVector& arguments,
+    const std::shared_ptr<const std::vector<int32_t>>& token_lengths,
+    std::vector<int> skip_tokens
+) :
+    ov::op::Op(arguments),
+    m_skip_tokens(skip_tokens),
+    m_token_lengths(token_lengths) {
+
+    if (m_token_lengths == nullptr) {
+        // the vocab comes unpacked from a packed string constant, take the token offsets right from it
+        auto vocab_node = arguments[1].get_node_shared_ptr();
+        auto packed_vocab_const = ov::is_type<StringTensorUnpack>(vocab_node) && arguments[1].get_index() == 0
+            ? as_type_ptr<Constant>(vocab_node->get_input_node_shared_ptr(0))
+            : nullptr;
+        if (packed_vocab_const && packed_vocab_const->get_element_type() == element::u8) {
+            auto packed_vocab_buf = static_cast<const char*>(packed_vocab_const->get_data_ptr());
+            auto packed_vocab_size = packed_vocab_const->get_byte_size();
+            auto vocab_size = packed_vocab_size >= 4 ? *reinterpret_cast<const int32_t*>(packed_vocab_buf + 0) : -1;
+            // otherwise the constant is not a packed string tensor, the lengths are computed in evaluate
+            if (vocab_size >= 0 && packed_vocab_size >= 4 + 4 * (size_t(vocab_size) + 1)) {
+                auto vocab_offsets = reinterpret_cast<const int32_t*>(packed_vocab_buf + 4);
+                m_token_lengths = std::make_shared<std::vector<int32_t>>(
+                    make_token_lengths(vocab_offsets, vocab_offsets + 1, vocab_size, m_skip_tokens));
+            }
+        }
+    }
+
+    constructor_validate_and_infer_types();
+}
+
 
 void VocabDecoder::validate_and_infer_types() {
     check_string_input(this, 1);
@@ -21,6 +81,8 @@ void VocabDecoder::validate_and_infer_types() {
 }
 
 bool VocabDecoder::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    OPENVINO_ASSERT(inputs.size() == 4, "Too few inputs passed to VocabDecoder, it means it is not converted properly or it is not used in the supported pattern");
+
     auto batch_size = inputs[0].get_shape()[0];
     auto seq_len    = inputs[0].get_shape()[1];
     auto input_data = inputs[0].data<const int32_t>();
@@ -30,23 +92,37 @@ bool VocabDecoder::evaluate(ov::TensorVector& outputs, const ov::TensorVector& i
     auto vocab_chars  = inputs[3].data<const uint8_t>();
     auto vocab_size   = inputs[1].get_size();
 
-    std::vector<std::vector<uint8_t>> vocab;
-    vocab.resize(vocab_size);
-
-    std::vector<uint8_t> empty = {};
-
-    OPENVINO_ASSERT(inputs.size() == 4, "Too few inputs passed to VocabDecoder, it means it is not converted properly or it is not used in the supported pattern");
+    auto token_lengths = m_token_lengths;
+    if (token_lengths == nullptr || token_lengths->size() != vocab_size) {
+        // the vocab is not a constant, compute token lengths for this call only
+        token_lengths = std::make_shared<std::vector<int32_t>>(
+            make_token_lengths(vocab_begins, vocab_ends, vocab_size, m_skip_tokens));
+    }
 
-    for(size_t id = 0; id < vocab_size; ++id) {
-        vocab[id] = std::vector<uint8_t>(vocab_chars + vocab_begins[id], vocab_chars + vocab_ends[id]);
+    // ids out of the vocab are decoded as empty strings
+    auto token_length = [&](int32_t token_id) {
+        return (0 <= token_id && size_t(token_id) < vocab_size) ? (*token_lengths)[token_id] : 0;
+    };
+
+    // First pass: exact number of decoded chars in each row
+    std::vector<size_t> row_offsets(batch_size + 1, 0);
+    ov::parallel_for(batch_size, [&](size_t batch) {
+        size_t row_size = 0;
+        for (size_t seq = batch * seq_len; seq < (batch + 1) * seq_len; ++seq) {
+            row_size += token_length(input_data[seq]);
+        }
+        row_offsets[batch + 1] = row_size;
+    });
+    for (size_t batch = 0; batch < batch_size; ++batch) {
+        row_offsets[batch + 1] += row_offsets[batch];
     }
+
     // Set output shapes
     outputs[0].set_shape({batch_size});
     outputs[1].set_shape({batch_size});
     outputs[2].set_shape({batch_size * seq_len});
     outputs[3].set_shape({batch_size * seq_len});
-    outputs[4].set_shape({batch_size * seq_len * 100});  // 100 chars - max token length
-    const size_t num_rows = inputs[0].get_size();
+    outputs[4].set_shape({row_offsets[batch_size]});
 
     // Get pointers in the output tensors
     auto new_ragged_begins = outputs[0].data<int32_t>();
@@ -54,28 +130,24 @@ bool VocabDecoder::evaluate(ov::TensorVector& outputs, const ov::TensorVector& i
     auto new_begins = outputs[2].data<int32_t>();
     auto new_ends   = outputs[3].data<int32_t>();
     auto new_chars  = outputs[4].data<uint8_t>();
-    uint32_t char_offset = 0;
 
-    for(size_t batch = 0; batch < batch_size; ++batch) {
+    // Second pass: rows are filled independently starting from the known offsets
+    ov::parallel_for(batch_size, [&](size_t batch) {
         new_ragged_begins[batch] = batch * seq_len;
         new_ragged_ends[batch]   = new_ragged_begins[batch] + seq_len;
+        size_t char_offset = row_offsets[batch];
 
         for(size_t seq = new_ragged_begins[batch]; seq < new_ragged_ends[batch]; ++seq) {
             auto token_id = input_data[seq];
-            std::vector<uint8_t> token;
-            if (std::find(m_skip_tokens.begin(), m_skip_tokens.end(), token_id) == m_skip_tokens.end()) {
-                token = vocab[token_id];
-            } else {
-                token = empty;
+            auto length = token_length(token_id);
+            if (length > 0) {
+                std::copy_n(vocab_chars + vocab_begins[token_id], length, new_chars + char_offset);
             }
 
-            std::copy(token.begin(), token.end(), &new_chars[char_offset]);
-
             new_begins[seq] = char_offset;
-            char_offset += token.size();
+            char_offset += length;
             new_ends[seq] = char_offset;
         }
-    }
-    outputs[4].set_shape({char_offset});
+    });
     return true;
 }
@@ -19,11 +19,16 @@ public:
         m_skip_tokens = skip_tokens;
         constructor_validate_and_infer_types();
     }
+    VocabDecoder(
+        const ov::OutputVector& arguments,
+        const std::shared_ptr<const std::vector<int32_t>>& token_lengths,
+        std::vector<int> skip_tokens
+    );
 
     void validate_and_infer_types() override;
 
     std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& inputs) const override {
-        return std::make_shared<VocabDecoder>(inputs, m_skip_tokens);
+        return std::make_shared<VocabDecoder>(inputs, m_token_lengths, m_skip_tokens);
     }
 
     bool visit_attributes(ov::AttributeVisitor& visitor) override {
@@ -39,4 +44,7 @@ public:
 private:
     // used std::unordered_set in the first draft, but there are no mapping and support for set attribute yet
     std::vector<int> m_skip_tokens;
+    // byte length of each vocab token with zeros for skipped tokens, built once from the vocab constant
+    // and shared between clones of the node
+    std::shared_ptr<const std::vector<int32_t>> m_token_lengths;
 };
@@ -69,44 +69,14 @@ void WordpieceTokenizer::validate_and_infer_types() {
 
 
 bool WordpieceTokenizer::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
-    auto ragged_begins = inputs[0].data<const int32_t>();
-    auto ragged_ends   = inputs[1].data<const int32_t>();
-    auto begins = inputs[2].data<const int32_t>();
-    auto ends   = inputs[3].data<const int32_t>();
-    auto chars  = inputs[4].data<const uint8_t>();
-
-    // Set output shapes
-    outputs[0].set_shape(inputs[0].get_shape());
-    outputs[1].set_shape(inputs[1].get_shape());
-    const size_t num_rows = inputs[0].get_size();
-
-
-    // FIXME: Not accurate estimation as there is theoretical possibility for re-use the same symbol area
-    // to represent different elements in ragged tensor
-    outputs[2].set_shape({inputs[4].get_size()});
-
-    // Get pointers in the output tensors
-    auto new_begins = outputs[0].data<int32_t>();
-    auto new_ends   = outputs[1].data<int32_t>();
-    auto new_elems  = outputs[2].data<int32_t>();
-    int32_t ragged_offset = 0;
-
-    for(size_t seq = 0; seq < num_rows; ++seq) {
-        new_begins[seq] = ragged_offset;
-
-        for(size_t ragged_col = ragged_begins[seq]; ragged_col < ragged_ends[seq]; ++ragged_col) {
-
-            auto str = std::string(chars + begins[ragged_col], chars + ends[ragged_col]);
-            std::vector<core::Token> results = m_tokenizer->Tokenize(str);
-
-            for (const core::Token& token : results) {
-                OPENVINO_ASSERT(ragged_offset < outputs[2].get_size());
-                new_elems[ragged_offset++] = token.id_;
-            };
-        }
-        new_ends[seq] = ragged_offset;
-    }
-    outputs[2].set_shape({size_t(ragged_offset)});
-    return true;
+    return evaluate_tokenization_helper(
+        outputs, inputs,
+        [this](std::string_view word, std::vector<int32_t>& token_ids) {
+            // FastWordPiece accepts std::string only, reuse a per-thread buffer to not allocate for each word
+            thread_local std::string word_buffer;
+            word_buffer.assign(word.data(), word.size());
+            for (const core::Token& token : m_tokenizer->Tokenize(word_buffer)) {
+                token_ids.push_back(token.id_);
+            }
+        });
 }
-
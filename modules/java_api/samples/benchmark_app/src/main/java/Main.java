@@ -0,0 +1,161 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+import org.intel.openvino.*;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+
+/*
+This is a throughput benchmark of asynchronous inference with OpenVINO Java API.
+It compares the blocking pattern, where every infer request is driven by its own Java thread
+calling start_async() and wait_async(), with AsyncInferQueue, where a single thread submits jobs
+and requests report completion through callbacks.
+To get the list of command line parameters run the application with `--help` paramether.
+*/
+public class Main {
+
+    static class Statistics {
+        private final List<Long> latencies = new ArrayList<Long>();
+        private long startTime;
+        private long endTime;
+
+        synchronized void add(long latency) {
+            latencies.add(latency);
+        }
+
+        synchronized void addAll(List<Long> values) {
+            latencies.addAll(values);
+        }
+
+        void print(String title) {
+            Collections.sort(latencies);
+            double duration = (endTime - startTime) / 1e6;
+            double median = latencies.isEmpty() ? 0 : latencies.get(latencies.size() / 2) / 1e6;
+
+            System.out.println("[ INFO ] " + title);
+            System.out.printf("Count:      %d iterations%n", latencies.size());
+            System.out.printf("Duration:   %.2f ms%n", duration);
+            System.out.printf("Latency:    %.2f ms%n", median);
+            System.out.printf("Throughput: %.2f FPS%n", latencies.size() * 1000.0 / duration);
+        }
+    }
+
+    static Tensor makeInput(Output input, Random random) {
+        if (input.get_element_type() != ElementType.f32) {
+            throw new IllegalArgumentException("Only f32 inputs are supported");
+        }
+        int[] shape = input.get_shape();
+        int size = 1;
+        for (int dim : shape) {
+            size *= dim;
+        }
+        float[] data = new float[size];
+        for (int i = 0; i < size; ++i) {
+            data[i] = random.nextFloat();
+        }
+        return new Tensor(shape, data);
+    }
+
+    static Statistics runBlocking(CompiledModel model, Tensor input, int nireq, long duration)
+            throws InterruptedException {
+        Statistics statistics = new Statistics();
+        List<Thread> threads = new ArrayList<Thread>();
+        for (int i = 0; i < nireq; ++i) {
+            final InferRequest request = model.create_infer_request();
+            request.set_input_tensor(input);
+            threads.add(
+                    new Thread(
+                            () -> {
+                                List<Long> latencies = new ArrayList<Long>();
+                                long deadline = statistics.startTime + duration;
+                                for (long start = System.nanoTime();
+                                        start < deadline;
+                                        start = System.nanoTime()) {
+                                    request.start_async();
+                                    request.wait_async();
+                                    latencies.add(System.nanoTime() - start);
+                                }
+                                statistics.addAll(latencies);
+                            }));
+        }
+
+        statistics.startTime = System.nanoTime();
+        for (Thread thread : threads) {
+            thread.start();
+        }
+        for (Thread thread : threads) {
+            thread.join();
+        }
+        statistics.endTime = System.nanoTime();
+        return statistics;
+    }
+
+    static Statistics runQueue(CompiledModel model, Tensor input, int nireq, long duration)
+            throws InterruptedException {
+        Statistics statistics = new Statistics();
+        AsyncInferQueue queue = new AsyncInferQueue(model, nireq);
+        queue.set_callback((request, start) -> statistics.add(System.nanoTime() - (Long) start));
+
+        statistics.startTime = System.nanoTime();
+        long deadline = statistics.startTime + duration;
+        for (long start = System.nanoTime(); start < deadline; start = System.nanoTime()) {
+            queue.start_async(input, start);
+        }
+        queue.wait_all();
+        statistics.endTime = System.nanoTime();
+        return statistics;
+    }
+
+    public static void main(String[] args) throws InterruptedException {
+        ArgumentParser parser = new ArgumentParser("This is asynchronous inference benchmark");
+        parser.addArgument("-m", "path to model .xml");
+        parser.addArgument("-d", "device, CPU by default");
+        parser.addArgument("-nireq", "number of infer requests, 4 by default");
+        parser.addArgument("-t", "duration of each mode in seconds, 20 by default");
+        parser.addArgument("-api", "blocking, queue or all (default)");
+        parser.parseArgs(args);
+
+        String xmlPath = parser.get("-m", null);
+        String device = parser.get("-d", "CPU");
+        int nireq = parser.getInteger("-nireq", 4);
+        long duration = parser.getInteger("-t", 20) * 1000000000L;
+        String api = parser.get("-api", "all");
+
+        if (xmlPath == null) {
+            System.out.println("Error: Missed argument: -m");
+            return;
+        }
+
+        Core core = new Core();
+        Map<String, String> properties = new HashMap<String, String>();
+        properties.put("PERFORMANCE_HINT", "THROUGHPUT");
+        properties.put("PERFORMANCE_HINT_NUM_REQUESTS", Integer.toString(nireq));
+        CompiledModel model = core.compile_model(xmlPath, device, properties);
+
+        List<Output> inputs = model.inputs();
+        if (inputs.size() != 1) {
+            System.out.println("Error: Only models with a single input are supported");
+            return;
+        }
+        Tensor input = makeInput(inputs.get(0), new Random(42));
+
+        // warm up
+        InferRequest request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+
+        if (api.equals("blocking") || api.equals("all")) {
+            runBlocking(model, input, nireq, duration)
+                    .print(nireq + " requests driven by blocking threads");
+        }
+        if (api.equals("queue") || api.equals("all")) {
+            runQueue(model, input, nireq, duration)
+                    .print(nireq + " requests of AsyncInferQueue with callbacks");
+        }
+    }
+}
@@ -76,6 +76,34 @@ JNIEXPORT jobject JNICALL Java_org_intel_openvino_CompiledModel_GetOutputs(JNIEn
     return 0;
 }
 
+JNIEXPORT jobjectArray JNICALL Java_org_intel_openvino_CompiledModel_GetPortNames(JNIEnv *env, jobject obj, jlong modelAddr, jboolean inputs) {
+    JNI_METHOD("GetPortNames",
+        CompiledModel *compiled_model = (CompiledModel *) modelAddr;
+        const std::vector<ov::Output<const ov::Node>>& ports = inputs ? compiled_model->inputs() : compiled_model->outputs();
+
+        jclass stringClass = env->FindClass("java/lang/String");
+        jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
+        jobjectArray result = env->NewObjectArray(ports.size(), stringArrayClass, nullptr);
+
+        for (size_t i = 0; i < ports.size(); ++i) {
+            const std::unordered_set<std::string>& names = ports[i].get_names();
+            jobjectArray portNames = env->NewObjectArray(names.size(), stringClass, nullptr);
+
+            jsize j = 0;
+            for (const auto &name : names) {
+                jstring nameObj = env->NewStringUTF(name.c_str());
+                env->SetObjectArrayElement(portNames, j++, nameObj);
+                env->DeleteLocalRef(nameObj);
+            }
+            env->SetObjectArrayElement(result, i, portNames);
+            env->DeleteLocalRef(portNames);
+        }
+
+        return result;
+    )
+    return 0;
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_delete(JNIEnv *, jobject, jlong addr)
 {
     CompiledModel *compiled_model = (CompiledModel *)addr;
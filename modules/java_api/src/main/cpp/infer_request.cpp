@@ -9,6 +9,101 @@
 
 using namespace ov;
 
+namespace {
+
+// Completion callback of an infer request which calls InferRequest.onComplete of the Java object.
+// The Java request is referenced weakly: it owns the Java callbacks, and a strong reference from the native
+// request would keep it from being collected.
+class CompletionCallback
+{
+public:
+    CompletionCallback(JNIEnv *env, jobject request) : m_state(std::make_shared<State>(env, request)) {}
+
+    void operator()(std::exception_ptr error) const
+    {
+        JNIEnv *env = threadEnv(m_state->vm);
+        if (!env)
+            return;
+
+        jobject request = env->NewLocalRef(m_state->request);
+        if (!request)
+            return;
+
+        jthrowable exception = nullptr;
+        if (error)
+        {
+            std::string what = "unknown exception";
+            try
+            {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception &e)
+            {
+                what = e.what();
+            }
+            catch (...)
+            {
+            }
+            jstring message = env->NewStringUTF(what.c_str());
+            exception = (jthrowable)env->NewObject(m_state->exceptionClass, m_state->exceptionConstructor, message);
+            env->DeleteLocalRef(message);
+        }
+
+        env->CallVoidMethod(request, m_state->onComplete, exception);
+        // nothing can handle a Java exception on a runtime thread
+        if (env->ExceptionCheck())
+        {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+
+        if (exception)
+            env->DeleteLocalRef(exception);
+        env->DeleteLocalRef(request);
+    }
+
+private:
+    struct State
+    {
+        State(JNIEnv *env, jobject javaRequest)
+        {
+            env->GetJavaVM(&vm);
+            request = env->NewWeakGlobalRef(javaRequest);
+
+            jclass requestClass = env->GetObjectClass(javaRequest);
+            onComplete = env->GetMethodID(requestClass, "onComplete", "(Ljava/lang/Exception;)V");
+
+            jclass localExceptionClass = env->FindClass("java/lang/Exception");
+            exceptionClass = (jclass)env->NewGlobalRef(localExceptionClass);
+            exceptionConstructor = env->GetMethodID(exceptionClass, "<init>", "(Ljava/lang/String;)V");
+
+            env->DeleteLocalRef(localExceptionClass);
+            env->DeleteLocalRef(requestClass);
+        }
+
+        // the callback is destroyed with the native request, possibly on a runtime thread
+        ~State()
+        {
+            AttachedEnv env(vm);
+            if (env.get())
+            {
+                env.get()->DeleteWeakGlobalRef(request);
+                env.get()->DeleteGlobalRef(exceptionClass);
+            }
+        }
+
+        JavaVM *vm = nullptr;
+        jweak request = nullptr;
+        jmethodID onComplete = nullptr;
+        jclass exceptionClass = nullptr;
+        jmethodID exceptionConstructor = nullptr;
+    };
+
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *env, jobject obj, jlong addr)
 {
     JNI_METHOD("Infer",
@@ -32,6 +127,58 @@ JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *env, jo
     )
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *env, jobject, jlong addr, jobject request)
+{
+    JNI_METHOD("SetCallback",
+        InferRequest *infer_request = (InferRequest *)addr;
+        infer_request->set_callback(CompletionCallback(env, request));
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetTensors(JNIEnv *env, jobject, jlong addr, jboolean inputs, jlongArray tensorAddrs)
+{
+    JNI_METHOD("SetTensors",
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        std::vector<jlong> handles(env->GetArrayLength(tensorAddrs));
+        env->GetLongArrayRegion(tensorAddrs, 0, handles.size(), handles.data());
+
+        for (size_t i = 0; i < handles.size(); ++i) {
+            if (!handles[i])
+                continue;
+            const Tensor *tensor = (Tensor *)handles[i];
+            if (inputs)
+                infer_request->set_input_tensor(i, *tensor);
+            else
+                infer_request->set_output_tensor(i, *tensor);
+        }
+    )
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_GetTensors(JNIEnv *env, jobject, jlong addr, jboolean inputs, jlongArray tensorAddrs)
+{
+    JNI_METHOD("GetTensors",
+        InferRequest *infer_request = (InferRequest *)addr;
+
+        std::vector<jlong> handles(env->GetArrayLength(tensorAddrs));
+        env->GetLongArrayRegion(tensorAddrs, 0, handles.size(), handles.data());
+
+        // all tensors are taken first, so no handle is created if a port doesn't exist
+        std::vector<Tensor> tensors(handles.size());
+        for (size_t i = 0; i < handles.size(); ++i)
+            tensors[i] = inputs ? infer_request->get_input_tensor(i) : infer_request->get_output_tensor(i);
+
+        // existing handles are rebound to the tensors of the request, new ones are created for empty slots only
+        for (size_t i = 0; i < handles.size(); ++i) {
+            if (handles[i])
+                *(Tensor *)handles[i] = tensors[i];
+            else
+                handles[i] = (jlong)new Tensor(tensors[i]);
+        }
+        env->SetLongArrayRegion(tensorAddrs, 0, handles.size(), handles.data());
+    )
+}
+
 JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *env, jobject, jlong addr, jlong tensorAddr)
 {
     JNI_METHOD("SetInputTensor",
@@ -61,6 +208,40 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor(JNI
     return 0;
 }
 
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor1(JNIEnv *env, jobject, jlong addr, jint index, jlong tensorAddr)
+{
+    JNI_METHOD("SetInputTensor1",
+        InferRequest *infer_request = (InferRequest *)addr;
+        Tensor *tensor = (Tensor *)tensorAddr;
+        infer_request->set_input_tensor(index, *tensor);)
+}
+
+JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor1(JNIEnv *env, jobject, jlong addr, jint index, jlong tensorAddr)
+{
+    JNI_METHOD("SetOutputTensor1",
+        InferRequest *infer_request = (InferRequest *)addr;
+        Tensor *tensor = (Tensor *)tensorAddr;
+        infer_request->set_output_tensor(index, *tensor);)
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetInputTensor(JNIEnv *env, jobject obj, jlong addr, jint index)
+{
+    JNI_METHOD("GetInputTensor",
+        InferRequest *infer_request = (InferRequest *)addr;
+        return (jlong)new Tensor(infer_request->get_input_tensor(index));
+    )
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor1(JNIEnv *env, jobject obj, jlong addr, jint index)
+{
+    JNI_METHOD("GetOutputTensor1",
+        InferRequest *infer_request = (InferRequest *)addr;
+        return (jlong)new Tensor(infer_request->get_output_tensor(index));
+    )
+    return 0;
+}
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetTensor(JNIEnv *env, jobject obj, jlong addr, jstring tensorName)
 {
     JNI_METHOD("GetTensor",
@@ -231,3 +231,64 @@ static jobject vectorToJavaList(JNIEnv *env, std::vector<std::string> items)
 
     return nullptr;
 }
+
+// JNIEnv of the current thread. Threads created by OpenVINO (callback executors, destructors of shared
+// objects released there) are attached to the JVM for the lifetime of the object and detached after it.
+class AttachedEnv
+{
+public:
+    explicit AttachedEnv(JavaVM *vm) : m_vm(vm)
+    {
+        if (m_vm->GetEnv((void **)&m_env, JNI_VERSION_1_6) == JNI_EDETACHED)
+        {
+            m_attached = m_vm->AttachCurrentThread((void **)&m_env, nullptr) == JNI_OK;
+            if (!m_attached)
+                m_env = nullptr;
+        }
+    }
+
+    ~AttachedEnv()
+    {
+        if (m_attached)
+            m_vm->DetachCurrentThread();
+    }
+
+    AttachedEnv(const AttachedEnv &) = delete;
+    AttachedEnv &operator=(const AttachedEnv &) = delete;
+
+    JNIEnv *get() const { return m_env; }
+
+private:
+    JavaVM *m_vm;
+    JNIEnv *m_env = nullptr;
+    bool m_attached = false;
+};
+
+// JNIEnv of a thread that runs Java code repeatedly, e.g. a callback executor thread of the runtime.
+// The thread is attached once as a daemon, so it doesn't keep the JVM alive, and detached when it exits.
+// The function is inline rather than static, so all translation units share one attachment per thread.
+inline JNIEnv *threadEnv(JavaVM *vm)
+{
+    struct ThreadAttachment
+    {
+        JavaVM *vm = nullptr;
+        ~ThreadAttachment()
+        {
+            // Only a thread attached here is detached. GetEnv doesn't report it attached
+            // once the JVM is destroyed, e.g. when the runtime joins its threads at process exit.
+            JNIEnv *env = nullptr;
+            if (vm && vm->GetEnv((void **)&env, JNI_VERSION_1_6) == JNI_OK)
+                vm->DetachCurrentThread();
+        }
+    };
+    thread_local ThreadAttachment attachment;
+
+    JNIEnv *env = nullptr;
+    if (vm->GetEnv((void **)&env, JNI_VERSION_1_6) == JNI_EDETACHED)
+    {
+        if (vm->AttachCurrentThreadAsDaemon((void **)&env, nullptr) != JNI_OK)
+            return nullptr;
+        attachment.vm = vm;
+    }
+    return env;
+}
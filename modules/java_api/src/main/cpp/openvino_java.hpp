@@ -44,14 +44,22 @@ extern "C"
     JNIEXPORT void JNICALL Java_org_intel_openvino_CompiledModel_delete(JNIEnv *, jobject, jlong);
     JNIEXPORT jobject JNICALL Java_org_intel_openvino_CompiledModel_GetInputs(JNIEnv *, jobject, jlong);
     JNIEXPORT jobject JNICALL Java_org_intel_openvino_CompiledModel_GetOutputs(JNIEnv *, jobject, jlong);
+    JNIEXPORT jobjectArray JNICALL Java_org_intel_openvino_CompiledModel_GetPortNames(JNIEnv *, jobject, jlong, jboolean);
 
     // ov::InferRequest
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Infer(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_StartAsync(JNIEnv *, jobject, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_Wait(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetCallback(JNIEnv *, jobject, jlong, jobject);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetTensors(JNIEnv *, jobject, jlong, jboolean, jlongArray);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_GetTensors(JNIEnv *, jobject, jlong, jboolean, jlongArray);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor(JNIEnv *, jobject, jlong, jlong);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor(JNIEnv *, jobject, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetInputTensor1(JNIEnv *, jobject, jlong, jint, jlong);
+    JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetOutputTensor1(JNIEnv *, jobject, jlong, jint, jlong);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetInputTensor(JNIEnv *, jobject, jlong, jint);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetOutputTensor1(JNIEnv *, jobject, jlong, jint);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_InferRequest_GetTensor(JNIEnv *, jobject, jlong, jstring);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_SetTensor(JNIEnv *, jobject, jlong, jstring, jlong);
     JNIEXPORT void JNICALL Java_org_intel_openvino_InferRequest_delete(JNIEnv *, jobject, jlong);
@@ -61,6 +69,9 @@ extern "C"
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorFloat(JNIEnv *, jobject, jintArray, jfloatArray);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorInt(JNIEnv *, jobject, jintArray, jintArray);
     JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorLong(JNIEnv *, jobject, jintArray, jlongArray);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorByteBuffer(JNIEnv *, jobject, jint, jintArray, jobject);
+    JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_ShareData(JNIEnv *, jobject, jlong);
+    JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_GetByteBuffer(JNIEnv *, jobject, jlong);
     JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *, jobject, jlong);
     JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_GetShape(JNIEnv *, jobject, jlong);
     JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *, jobject, jlong);
@@ -9,6 +9,59 @@
 
 using namespace ov;
 
+namespace {
+
+// Gives the memory of a direct java.nio.ByteBuffer to ov::Tensor. The global reference keeps the buffer from
+// being collected while any copy of the tensor is alive, e.g. the one set to an infer request.
+class DirectBufferAllocator
+{
+public:
+    DirectBufferAllocator(JNIEnv *env, jobject buffer) : m_buffer(std::make_shared<Buffer>(env, buffer)) {}
+
+    void *allocate(size_t bytes, size_t)
+    {
+        if (bytes > static_cast<size_t>(m_buffer->capacity))
+            throw std::runtime_error("Buffer capacity " + std::to_string(m_buffer->capacity) +
+                                     " is less than the tensor byte size " + std::to_string(bytes));
+        return m_buffer->data;
+    }
+
+    void deallocate(void *, size_t, size_t) {}
+
+    bool is_equal(const DirectBufferAllocator &other) const { return m_buffer == other.m_buffer; }
+
+private:
+    struct Buffer
+    {
+        Buffer(JNIEnv *env, jobject buffer)
+        {
+            data = env->GetDirectBufferAddress(buffer);
+            capacity = env->GetDirectBufferCapacity(buffer);
+            if (capacity < 0)
+                throw std::runtime_error("Buffer is not a direct buffer!");
+            env->GetJavaVM(&vm);
+            ref = env->NewGlobalRef(buffer);
+        }
+
+        // the last copy of a tensor may be released by a thread of the runtime
+        ~Buffer()
+        {
+            AttachedEnv env(vm);
+            if (env.get())
+                env.get()->DeleteGlobalRef(ref);
+        }
+
+        JavaVM *vm = nullptr;
+        jobject ref = nullptr;
+        void *data = nullptr;
+        jlong capacity = 0;
+    };
+
+    std::shared_ptr<Buffer> m_buffer;
+};
+
+} // namespace
+
 JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorCArray(JNIEnv *env, jobject, jint type, jintArray shape, jlong matDataAddr)
 {
     JNI_METHOD(
@@ -83,6 +136,43 @@ JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorLong(JNIEnv *env, j
     return 0;
 }
 
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_TensorByteBuffer(JNIEnv *env, jobject, jint type, jintArray shape, jobject buffer)
+{
+    JNI_METHOD(
+        "TensorByteBuffer",
+        Shape input_shape = jintArrayToVector(env, shape);
+        Tensor *ov_tensor = new Tensor(element::Type_t(type), input_shape, DirectBufferAllocator(env, buffer));
+
+        return (jlong)ov_tensor;
+    );
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL Java_org_intel_openvino_Tensor_ShareData(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "ShareData",
+        Tensor *ov_tensor = (Tensor *)addr;
+        return (jlong)new Tensor(*ov_tensor);
+    )
+    return 0;
+}
+
+JNIEXPORT jobject JNICALL Java_org_intel_openvino_Tensor_GetByteBuffer(JNIEnv *env, jobject, jlong addr)
+{
+    JNI_METHOD(
+        "GetByteBuffer",
+        Tensor *ov_tensor = (Tensor *)addr;
+
+        jobject result = env->NewDirectByteBuffer(ov_tensor->data(), (jlong)ov_tensor->get_byte_size());
+        if (!result) {
+            throw std::runtime_error("Direct buffers are not supported by the JVM!");
+        }
+        return result;
+    )
+    return 0;
+}
+
 JNIEXPORT jint JNICALL Java_org_intel_openvino_Tensor_GetSize(JNIEnv *env, jobject, jlong addr)
 {
     JNI_METHOD(
@@ -126,12 +216,8 @@ JNIEXPORT jfloatArray JNICALL Java_org_intel_openvino_Tensor_asFloat(JNIEnv *env
         jfloatArray result = env->NewFloatArray(size);
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jfloat *arr = env->GetFloatArrayElements(result, nullptr);
-
-        for (size_t i = 0; i < size; ++i)
-            arr[i] = data[i];
-
-        env->ReleaseFloatArrayElements(result, arr, 0);
+        }
+        env->SetFloatArrayRegion(result, 0, size, data);
         return result;
     )
     return 0;
@@ -149,12 +235,8 @@ JNIEXPORT jintArray JNICALL Java_org_intel_openvino_Tensor_asInt(JNIEnv *env, jo
         jintArray result = env->NewIntArray(size);
         if (!result) {
             throw std::runtime_error("Out of memory!");
-        } jint *arr = env->GetIntArrayElements(result, nullptr);
-
-        for (size_t i = 0; i < size; ++i)
-            arr[i] = data[i];
-
-        env->ReleaseIntArrayElements(result, arr, 0);
+        }
+        env->SetIntArrayRegion(result, 0, size, (const jint *)data);
         return result;
     )
     return 0;
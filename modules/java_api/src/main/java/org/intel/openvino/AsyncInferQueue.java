@@ -0,0 +1,179 @@
+// Copyright (C) 2020-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+package org.intel.openvino;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.function.BiConsumer;
+
+/**
+ * A pool of infer requests of a compiled model which run asynchronously.
+ *
+ * <p>Each job takes an idle request, sets its inputs and starts it. The request becomes idle again
+ * after the completion callback, so the number of jobs in flight never exceeds the pool size and
+ * the device is kept busy without a Java thread waiting for each request.
+ */
+public class AsyncInferQueue {
+
+    private final List<InferRequest> requests;
+    private final Object[] userdata;
+    private final ArrayDeque<Integer> idle;
+    private volatile BiConsumer<InferRequest, Object> callback;
+    private Exception error;
+
+    /**
+     * Creates a queue of infer requests.
+     *
+     * @param model Compiled model to create the requests for.
+     * @param jobs Number of requests, the optimal one depends on the device and its streams.
+     */
+    public AsyncInferQueue(CompiledModel model, int jobs) {
+        if (jobs <= 0) {
+            throw new IllegalArgumentException("Number of jobs must be positive");
+        }
+        requests = new ArrayList<InferRequest>(jobs);
+        userdata = new Object[jobs];
+        idle = new ArrayDeque<Integer>(jobs);
+        for (int i = 0; i < jobs; ++i) {
+            final int id = i;
+            InferRequest request = model.create_infer_request();
+            request.set_callback(e -> onComplete(id, e));
+            requests.add(request);
+            idle.add(id);
+        }
+    }
+
+    /**
+     * Sets a callback called with the request and its userdata when a job finishes successfully.
+     *
+     * <p>The callback is called from a thread of the OpenVINO runtime, outputs of the request are
+     * valid until the callback returns.
+     *
+     * @param callback Function to call on completion of each job.
+     */
+    public void set_callback(BiConsumer<InferRequest, Object> callback) {
+        this.callback = callback;
+    }
+
+    /**
+     * Starts a job on an idle request, waiting for one if all requests are busy.
+     *
+     * @param inputs Map of pairs: (tensor name, tensor) to set to the request.
+     * @param userdata Any object passed to the callback of this job.
+     */
+    public void start_async(Map<String, Tensor> inputs, Object userdata)
+            throws InterruptedException {
+        int id = acquire(userdata);
+        InferRequest request = requests.get(id);
+        try {
+            for (Map.Entry<String, Tensor> input : inputs.entrySet()) {
+                request.set_tensor(input.getKey(), input.getValue());
+            }
+            request.start_async();
+        } catch (RuntimeException e) {
+            release(id);
+            throw e;
+        }
+    }
+
+    /**
+     * Starts a job on an idle request of a model with a single input, waiting for one if all
+     * requests are busy.
+     *
+     * @param input Input tensor to set to the request.
+     * @param userdata Any object passed to the callback of this job.
+     */
+    public void start_async(Tensor input, Object userdata) throws InterruptedException {
+        int id = acquire(userdata);
+        InferRequest request = requests.get(id);
+        try {
+            request.set_input_tensor(input);
+            request.start_async();
+        } catch (RuntimeException e) {
+            release(id);
+            throw e;
+        }
+    }
+
+    /**
+     * Waits for all started jobs to finish.
+     *
+     * <p>If some of the jobs failed since the previous call, the first failure is thrown.
+     */
+    public void wait_all() throws InterruptedException {
+        Exception failure;
+        synchronized (this) {
+            while (idle.size() < requests.size()) {
+                wait();
+            }
+            failure = error;
+            error = null;
+        }
+        if (failure != null) {
+            throw new RuntimeException("Asynchronous inference failed", failure);
+        }
+    }
+
+    /** Returns the id of an idle request, waiting for one if all requests are busy. */
+    public synchronized int get_idle_request_id() throws InterruptedException {
+        while (idle.isEmpty()) {
+            wait();
+        }
+        return idle.peekFirst();
+    }
+
+    /** Returns true if there is at least one idle request. */
+    public synchronized boolean is_ready() {
+        return !idle.isEmpty();
+    }
+
+    /** Returns the request with the given id. */
+    public InferRequest get(int id) {
+        return requests.get(id);
+    }
+
+    /** Returns the number of requests in the queue. */
+    public int size() {
+        return requests.size();
+    }
+
+    private synchronized int acquire(Object data) throws InterruptedException {
+        while (idle.isEmpty()) {
+            wait();
+        }
+        int id = idle.pollFirst();
+        userdata[id] = data;
+        return id;
+    }
+
+    private synchronized Object getUserdata(int id) {
+        return userdata[id];
+    }
+
+    private synchronized void release(int id) {
+        userdata[id] = null;
+        idle.addLast(id);
+        notifyAll();
+    }
+
+    private void onComplete(int id, Exception failure) {
+        try {
+            BiConsumer<InferRequest, Object> callback = this.callback;
+            if (failure == null && callback != null) {
+                callback.accept(requests.get(id), getUserdata(id));
+            }
+        } catch (RuntimeException e) {
+            failure = e;
+        } finally {
+            synchronized (this) {
+                if (failure != null && error == null) {
+                    error = failure;
+                }
+            }
+            release(id);
+        }
+    }
+}
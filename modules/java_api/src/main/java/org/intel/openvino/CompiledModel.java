@@ -3,7 +3,10 @@
 
 package org.intel.openvino;
 
+import java.util.Collections;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 
 /**
  * This class represents a compiled model.
@@ -13,8 +16,18 @@ import java.util.List;
  */
 public class CompiledModel extends Wrapper {
 
+    // ports of a compiled model never change, so they are read from the native model once
+    private final List<Output> inputs;
+    private final List<Output> outputs;
+    private final Map<String, Integer> inputIndices;
+    private final Map<String, Integer> outputIndices;
+
     protected CompiledModel(long addr) {
         super(addr);
+        inputs = Collections.unmodifiableList(GetInputs(addr));
+        outputs = Collections.unmodifiableList(GetOutputs(addr));
+        inputIndices = indexNames(GetPortNames(addr, true));
+        outputIndices = indexNames(GetPortNames(addr, false));
     }
 
     /**
@@ -24,27 +37,67 @@ public class CompiledModel extends Wrapper {
      * @return {@link InferRequest} object
      */
     public InferRequest create_infer_request() {
-        return new InferRequest(CreateInferRequest(nativeObj));
+        return new InferRequest(CreateInferRequest(nativeObj), inputs.size(), outputs.size());
     }
 
     /**
      * Gets all inputs of a compiled model. They contain information about input tensors such as
      * tensor shape, names, and element type.
      *
-     * @return List of model inputs.
+     * @return Immutable list of model inputs, the same for every call.
      */
     public List<Output> inputs() {
-        return GetInputs(nativeObj);
+        return inputs;
     }
 
     /**
      * Gets all outputs of a compiled model. They contain information about output tensors such as
      * tensor shape, name, and element type.
      *
-     * @return List of model outputs.
+     * @return Immutable list of model outputs, the same for every call.
      */
     public List<Output> outputs() {
-        return GetOutputs(nativeObj);
+        return outputs;
+    }
+
+    /**
+     * Gets the index of an input by any of its tensor names, to be used with the index based
+     * methods of {@link InferRequest} instead of the names.
+     *
+     * @param name Tensor name of the input.
+     * @return Index of the input in {@link CompiledModel#inputs()}.
+     */
+    public int input_index(String name) {
+        return findIndex(inputIndices, name);
+    }
+
+    /**
+     * Gets the index of an output by any of its tensor names, to be used with the index based
+     * methods of {@link InferRequest} instead of the names.
+     *
+     * @param name Tensor name of the output.
+     * @return Index of the output in {@link CompiledModel#outputs()}.
+     */
+    public int output_index(String name) {
+        return findIndex(outputIndices, name);
+    }
+
+    private static Map<String, Integer> indexNames(String[][] portNames) {
+        Map<String, Integer> indices = new HashMap<String, Integer>();
+        for (int i = 0; i < portNames.length; ++i) {
+            for (String name : portNames[i]) {
+                indices.put(name, i);
+            }
+        }
+        return Collections.unmodifiableMap(indices);
+    }
+
+    private static int findIndex(Map<String, Integer> indices, String name) {
+        Integer index = indices.get(name);
+        if (index == null) {
+            throw new IllegalArgumentException("Port for tensor name " + name + " was not found");
+        }
+        return index;
     }
 
     /*----------------------------------- native methods -----------------------------------*/
@@ -54,6 +107,8 @@ public class CompiledModel extends Wrapper {
 
     private static native List<Output> GetOutputs(long addr);
 
+    private static native String[][] GetPortNames(long addr, boolean inputs);
+
     @Override
     protected native void delete(long nativeObj);
 }
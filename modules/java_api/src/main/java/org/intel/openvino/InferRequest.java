@@ -3,13 +3,36 @@
 
 package org.intel.openvino;
 
+import java.util.Collections;
+import java.util.Set;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.function.Consumer;
+
 /** This is a class of infer request that can be run in asynchronous or synchronous manners. */
 public class InferRequest extends Wrapper {
 
+    // requests with pending futures, which may be not referenced by the application otherwise
+    private static final Set<InferRequest> running =
+            Collections.newSetFromMap(new ConcurrentHashMap<InferRequest, Boolean>());
+
     private boolean isReleased = false;
+    private boolean isCallbackSet = false;
+    private volatile Consumer<Exception> callback;
+    private final AtomicReference<CompletableFuture<InferRequest>> future =
+            new AtomicReference<CompletableFuture<InferRequest>>();
+    // native handles passed to bulk methods, reused between calls
+    private long[] inputHandles = new long[0];
+    private long[] outputHandles = new long[0];
+    // tensors of all ports returned by the bulk getters without arguments, reused between calls
+    private final Tensor[] inputTensors;
+    private final Tensor[] outputTensors;
 
-    protected InferRequest(long addr) {
+    protected InferRequest(long addr, int numInputs, int numOutputs) {
         super(addr);
+        inputTensors = new Tensor[numInputs];
+        outputTensors = new Tensor[numOutputs];
     }
 
     /**
@@ -57,6 +80,49 @@ public class InferRequest extends Wrapper {
         Wait(nativeObj);
     }
 
+    /**
+     * Sets a callback to be called when an asynchronous inference finishes.
+     *
+     * <p>The callback is called from a thread of the OpenVINO runtime, which is attached to the JVM
+     * once, so no Java thread is blocked while the request is running. It gets null if the
+     * inference succeeded or the exception otherwise. The callback must not call {@link
+     * InferRequest#wait_async()} of this request, but it may start the next inference.
+     *
+     * @param callback Function to call on completion, null to remove it.
+     */
+    public void set_callback(Consumer<Exception> callback) {
+        this.callback = callback;
+        enableCallback();
+    }
+
+    /**
+     * Starts inference of specified input(s) in asynchronous mode and returns a future completed
+     * with this request when the inference finishes.
+     *
+     * <p>The future is completed from a thread of the OpenVINO runtime, so non-async dependent
+     * stages run there too and should be short. Use the async variants of {@link
+     * CompletableFuture} methods to run heavy stages in another executor.
+     *
+     * @return Future of this request, completed exceptionally if the inference fails.
+     */
+    public CompletableFuture<InferRequest> infer_async() {
+        enableCallback();
+
+        CompletableFuture<InferRequest> result = new CompletableFuture<InferRequest>();
+        if (!future.compareAndSet(null, result)) {
+            throw new IllegalStateException("Infer request is busy");
+        }
+        running.add(this);
+        try {
+            StartAsync(nativeObj);
+        } catch (Exception e) {
+            running.remove(this);
+            future.set(null);
+            result.completeExceptionally(e);
+        }
+        return result;
+    }
+
     /**
      * Sets an output tensor to infer models with single output.
      *
@@ -68,6 +134,50 @@ public class InferRequest extends Wrapper {
         SetOutputTensor(nativeObj, tensor.nativeObj);
     }
 
+    /**
+     * Sets an input tensor by input port index.
+     *
+     * @param index Index of the input in {@link CompiledModel#inputs()}, see {@link
+     *     CompiledModel#input_index(String)}.
+     * @param tensor Reference to the input tensor.
+     */
+    public void set_input_tensor(int index, Tensor tensor) {
+        SetInputTensor1(nativeObj, index, tensor.nativeObj);
+    }
+
+    /**
+     * Sets an output tensor by output port index.
+     *
+     * @param index Index of the output in {@link CompiledModel#outputs()}, see {@link
+     *     CompiledModel#output_index(String)}.
+     * @param tensor Reference to the output tensor.
+     */
+    public void set_output_tensor(int index, Tensor tensor) {
+        SetOutputTensor1(nativeObj, index, tensor.nativeObj);
+    }
+
+    /**
+     * Gets an input tensor by input port index.
+     *
+     * @param index Index of the input in {@link CompiledModel#inputs()}, see {@link
+     *     CompiledModel#input_index(String)}.
+     * @return Input tensor of the request.
+     */
+    public Tensor get_input_tensor(int index) {
+        return new Tensor(GetInputTensor(nativeObj, index));
+    }
+
+    /**
+     * Gets an output tensor by output port index.
+     *
+     * @param index Index of the output in {@link CompiledModel#outputs()}, see {@link
+     *     CompiledModel#output_index(String)}.
+     * @return Output tensor of the request.
+     */
+    public Tensor get_output_tensor(int index) {
+        return new Tensor(GetOutputTensor1(nativeObj, index));
+    }
+
     /**
      * Gets an input/output tensor for inference by tensor name.
      *
@@ -89,6 +199,78 @@ public class InferRequest extends Wrapper {
         SetTensor(nativeObj, tensorName, tensor.nativeObj);
     }
 
+    /**
+     * Sets input tensors by input port index in a single native call.
+     *
+     * @param tensors Tensors of the inputs in the order of {@link CompiledModel#inputs()}, null
+     *     elements keep the current tensors of the corresponding inputs.
+     */
+    public void set_input_tensors(Tensor[] tensors) {
+        SetTensors(nativeObj, true, toHandles(true, tensors));
+    }
+
+    /**
+     * Sets output tensors by output port index in a single native call.
+     *
+     * @param tensors Tensors of the outputs in the order of {@link CompiledModel#outputs()}, null
+     *     elements keep the current tensors of the corresponding outputs.
+     */
+    public void set_output_tensors(Tensor[] tensors) {
+        SetTensors(nativeObj, false, toHandles(false, tensors));
+    }
+
+    /**
+     * Gets input tensors by input port index in a single native call.
+     *
+     * <p>{@link Tensor} objects of the array are reused: they are rebound to the current tensors
+     * of the request, so passing the same array on every inference allocates nothing. New objects
+     * are created for null elements only.
+     *
+     * @param tensors Array to fill, its length is the number of inputs to get.
+     * @return The same array.
+     */
+    public Tensor[] get_input_tensors(Tensor[] tensors) {
+        return getTensors(true, tensors);
+    }
+
+    /**
+     * Same as {@link InferRequest#get_input_tensors(Tensor[])} for all inputs of the model.
+     *
+     * <p>The request owns the returned array: every call returns the same array with the same
+     * {@link Tensor} objects rebound to the current tensors.
+     *
+     * @return Tensors of all inputs in the order of {@link CompiledModel#inputs()}.
+     */
+    public Tensor[] get_input_tensors() {
+        return getTensors(true, inputTensors);
+    }
+
+    /**
+     * Gets output tensors by output port index in a single native call.
+     *
+     * <p>{@link Tensor} objects of the array are reused: they are rebound to the current tensors
+     * of the request, so passing the same array on every inference allocates nothing. New objects
+     * are created for null elements only.
+     *
+     * @param tensors Array to fill, its length is the number of outputs to get.
+     * @return The same array.
+     */
+    public Tensor[] get_output_tensors(Tensor[] tensors) {
+        return getTensors(false, tensors);
+    }
+
+    /**
+     * Same as {@link InferRequest#get_output_tensors(Tensor[])} for all outputs of the model.
+     *
+     * <p>The request owns the returned array: every call returns the same array with the same
+     * {@link Tensor} objects rebound to the current tensors.
+     *
+     * @return Tensors of all outputs in the order of {@link CompiledModel#outputs()}.
+     */
+    public Tensor[] get_output_tensors() {
+        return getTensors(false, outputTensors);
+    }
+
     /**
      * Delete the native object to release resources.
      *
@@ -99,6 +281,62 @@ public class InferRequest extends Wrapper {
         isReleased = true;
     }
 
+    private long[] toHandles(boolean inputs, Tensor[] tensors) {
+        long[] handles = inputs ? inputHandles : outputHandles;
+        if (handles.length != tensors.length) {
+            handles = new long[tensors.length];
+            if (inputs) {
+                inputHandles = handles;
+            } else {
+                outputHandles = handles;
+            }
+        }
+        for (int i = 0; i < tensors.length; ++i) {
+            handles[i] = tensors[i] != null ? tensors[i].nativeObj : 0;
+        }
+        return handles;
+    }
+
+    private Tensor[] getTensors(boolean inputs, Tensor[] tensors) {
+        long[] handles = toHandles(inputs, tensors);
+        GetTensors(nativeObj, inputs, handles);
+        for (int i = 0; i < tensors.length; ++i) {
+            if (tensors[i] == null) {
+                tensors[i] = new Tensor(handles[i]);
+            } else {
+                tensors[i].rebound();
+            }
+        }
+        return tensors;
+    }
+
+    private synchronized void enableCallback() {
+        if (!isCallbackSet) {
+            SetCallback(nativeObj, this);
+            isCallbackSet = true;
+        }
+    }
+
+    /** Called by the native completion callback. */
+    private void onComplete(Exception error) {
+        CompletableFuture<InferRequest> result = future.getAndSet(null);
+        running.remove(this);
+        try {
+            Consumer<Exception> callback = this.callback;
+            if (callback != null) {
+                callback.accept(error);
+            }
+        } finally {
+            if (result != null) {
+                if (error == null) {
+                    result.complete(this);
+                } else {
+                    result.completeExceptionally(error);
+                }
+            }
+        }
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native void Infer(long addr);
 
@@ -106,12 +344,26 @@ public class InferRequest extends Wrapper {
 
     private static native void Wait(long addr);
 
+    private static native void SetCallback(long addr, InferRequest request);
+
+    private static native void SetTensors(long addr, boolean inputs, long[] tensorAddrs);
+
+    private static native void GetTensors(long addr, boolean inputs, long[] tensorAddrs);
+
     private static native void SetInputTensor(long addr, long tensorAddr);
 
     private static native void SetOutputTensor(long addr, long tensorAddr);
 
     private static native long GetOutputTensor(long addr);
 
+    private static native void SetInputTensor1(long addr, int index, long tensorAddr);
+
+    private static native void SetOutputTensor1(long addr, int index, long tensorAddr);
+
+    private static native long GetInputTensor(long addr, int index);
+
+    private static native long GetOutputTensor1(long addr, int index);
+
     private static native long GetTensor(long addr, String tensorName);
 
     private static native void SetTensor(long addr, String tensorName, long tensor);
@@ -3,6 +3,14 @@
 
 package org.intel.openvino;
 
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Collections;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
 /**
  * Tensor API holding host memory
  *
@@ -10,6 +18,8 @@ package org.intel.openvino;
  */
 public class Tensor extends Wrapper {
 
+    private ByteBuffer view;
+
     public Tensor(long addr) {
         super(addr);
     }
@@ -42,6 +52,21 @@ public class Tensor extends Wrapper {
         super(TensorLong(dims, data));
     }
 
+    /**
+     * Constructs a {@link Tensor} over the memory of a direct buffer without copying it.
+     *
+     * <p>The tensor starts at the beginning of the buffer regardless of its position, data is read
+     * and written in native byte order, see {@link ByteOrder#nativeOrder()}. The buffer is kept
+     * alive by the native tensor, including its copies set to infer requests.
+     *
+     * @param type element type of the tensor
+     * @param dims shape of the tensor
+     * @param buffer a direct buffer with a capacity of at least the tensor byte size
+     */
+    public Tensor(ElementType type, int[] dims, ByteBuffer buffer) {
+        super(TensorByteBuffer(type.getValue(), dims, requireDirect(buffer)));
+    }
+
     /**
      * Returns the total number of elements (a product of all the dims or 1 for scalar)
      *
@@ -66,6 +91,61 @@ public class Tensor extends Wrapper {
         return asInt(nativeObj);
     }
 
+    /**
+     * Returns the tensor data as a direct buffer in native byte order without copying it.
+     *
+     * <p>The buffer shares memory with the tensor, so for an output tensor of an infer request it
+     * shows the results of the latest inference. The memory stays valid while the buffer is
+     * reachable, even after this tensor is collected.
+     */
+    public ByteBuffer asByteBuffer() {
+        if (view == null) {
+            view = SharedView.create(nativeObj);
+        }
+        return view.duplicate().order(ByteOrder.nativeOrder());
+    }
+
+    /** Called when the native tensor is rebound to other memory. */
+    void rebound() {
+        view = null;
+    }
+
+    private static ByteBuffer requireDirect(ByteBuffer buffer) {
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("Tensor can be created from a direct buffer only");
+        }
+        return buffer;
+    }
+
+    /**
+     * A buffer over the memory of a native tensor copy. The copy is released once the buffer and
+     * all its duplicates become unreachable, which is checked each time a new view is created.
+     */
+    private static class SharedView extends PhantomReference<ByteBuffer> {
+        private static final ReferenceQueue<ByteBuffer> queue = new ReferenceQueue<ByteBuffer>();
+        private static final Set<SharedView> views =
+                Collections.newSetFromMap(new ConcurrentHashMap<SharedView, Boolean>());
+
+        // keeps the native copy until the buffer is collected
+        private final Tensor owner;
+
+        private SharedView(ByteBuffer buffer, Tensor owner) {
+            super(buffer, queue);
+            this.owner = owner;
+        }
+
+        static ByteBuffer create(long addr) {
+            for (Object stale = queue.poll(); stale != null; stale = queue.poll()) {
+                views.remove(stale);
+            }
+
+            Tensor owner = new Tensor(ShareData(addr));
+            ByteBuffer buffer = GetByteBuffer(owner.nativeObj);
+            views.add(new SharedView(buffer, owner));
+            return buffer;
+        }
+    }
+
     /*----------------------------------- native methods -----------------------------------*/
     private static native long TensorCArray(int type, int[] shape, long cArray);
 
@@ -75,6 +155,12 @@ public class Tensor extends Wrapper {
 
     private static native long TensorLong(int[] shape, long[] data);
 
+    private static native long TensorByteBuffer(int type, int[] shape, ByteBuffer buffer);
+
+    private static native long ShareData(long addr);
+
+    private static native ByteBuffer GetByteBuffer(long addr);
+
     private static native int[] GetShape(long addr);
 
     private static native float[] asFloat(long addr);
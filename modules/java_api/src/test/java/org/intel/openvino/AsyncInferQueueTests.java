@@ -0,0 +1,67 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Before;
+import org.junit.Test;
+
+public class AsyncInferQueueTests extends OVTest {
+
+    private CompiledModel model;
+    private int[] dimsArr = {1, 3, 32, 32};
+
+    @Before
+    public void init() {
+        Core core = new Core();
+        model = core.compile_model(modelXml, device);
+    }
+
+    private Tensor makeInput(int seed) {
+        float[] data = new float[1 * 3 * 32 * 32];
+        for (int i = 0; i < data.length; ++i) {
+            data[i] = ((i + seed) % 255) / 255.0f;
+        }
+        return new Tensor(dimsArr, data);
+    }
+
+    @Test
+    public void testStartAsync() throws Exception {
+        int jobs = 10;
+        Tensor[] inputs = new Tensor[jobs];
+        float[][] expected = new float[jobs][];
+        InferRequest request = model.create_infer_request();
+        for (int i = 0; i < jobs; ++i) {
+            inputs[i] = makeInput(i);
+            request.set_input_tensor(inputs[i]);
+            request.infer();
+            expected[i] = request.get_output_tensor().data();
+        }
+
+        AsyncInferQueue queue = new AsyncInferQueue(model, 3);
+        float[][] results = new float[jobs][];
+        queue.set_callback(
+                (r, userdata) -> results[(Integer) userdata] = r.get_output_tensor().data());
+
+        for (int i = 0; i < jobs; ++i) {
+            queue.start_async(inputs[i], i);
+        }
+        queue.wait_all();
+
+        assertTrue(queue.is_ready());
+        for (int i = 0; i < jobs; ++i) {
+            assertArrayEquals(expected[i], results[i], 0.0f);
+        }
+    }
+
+    @Test(expected = RuntimeException.class)
+    public void testCallbackFailure() throws Exception {
+        AsyncInferQueue queue = new AsyncInferQueue(model, 2);
+        queue.set_callback(
+                (r, userdata) -> {
+                    throw new IllegalStateException("callback failed");
+                });
+
+        queue.start_async(makeInput(0), null);
+        queue.wait_all();
+    }
+}
@@ -2,6 +2,7 @@ package org.intel.openvino;
 
 import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertSame;
 
 import org.junit.Before;
 import org.junit.Test;
@@ -39,4 +40,18 @@ public class CompiledModelTests extends OVTest {
         int[] shape = new int[] {1, 10};
         assertArrayEquals("Shape", shape, outputs.get(0).get_shape());
     }
+
+    @Test
+    public void testPortIndices() {
+        assertSame(model.inputs(), model.inputs());
+        assertSame(model.outputs(), model.outputs());
+
+        assertEquals(0, model.input_index("data"));
+        assertEquals(0, model.output_index("fc_out"));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testUnknownPortName() {
+        model.input_index("fc_out");
+    }
 }
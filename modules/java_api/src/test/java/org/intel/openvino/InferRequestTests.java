@@ -0,0 +1,102 @@
+package org.intel.openvino;
+
+import static org.junit.Assert.*;
+
+import org.junit.Before;
+import org.junit.Test;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicReference;
+
+public class InferRequestTests extends OVTest {
+
+    private InferRequest request;
+    private Tensor input;
+    private float[] expected;
+
+    @Before
+    public void init() {
+        Core core = new Core();
+        CompiledModel model = core.compile_model(modelXml, device);
+        request = model.create_infer_request();
+
+        float[] data = new float[1 * 3 * 32 * 32];
+        for (int i = 0; i < data.length; ++i) {
+            data[i] = (i % 255) / 255.0f;
+        }
+        input = new Tensor(new int[] {1, 3, 32, 32}, data);
+        request.set_input_tensor(input);
+
+        request.infer();
+        expected = request.get_output_tensor().data();
+    }
+
+    @Test
+    public void testSetCallback() throws Exception {
+        CountDownLatch done = new CountDownLatch(1);
+        AtomicReference<Exception> error = new AtomicReference<Exception>();
+        request.set_callback(
+                e -> {
+                    error.set(e);
+                    done.countDown();
+                });
+
+        request.start_async();
+
+        assertTrue(done.await(60, TimeUnit.SECONDS));
+        assertNull(error.get());
+        assertArrayEquals(expected, request.get_output_tensor().data(), 0.0f);
+    }
+
+    @Test
+    public void testInferAsync() throws Exception {
+        CompletableFuture<InferRequest> future = request.infer_async();
+
+        InferRequest result = future.get(60, TimeUnit.SECONDS);
+        assertSame(request, result);
+        assertArrayEquals(expected, result.get_output_tensor().data(), 0.0f);
+
+        // the request can be reused once the future is completed
+        float[] output = request.infer_async().thenApply(r -> r.get_output_tensor().data()).get();
+        assertArrayEquals(expected, output, 0.0f);
+    }
+
+    @Test
+    public void testTensorsByIndex() {
+        InferRequest other = new Core().compile_model(modelXml, device).create_infer_request();
+        other.set_input_tensors(new Tensor[] {input});
+        other.infer();
+
+        Tensor[] outputs = other.get_output_tensors();
+        assertEquals(1, outputs.length);
+        assertArrayEquals(expected, outputs[0].data(), 0.0f);
+
+        // Tensor objects are reused by the next calls
+        Tensor output = outputs[0];
+        other.infer();
+        assertSame(outputs, other.get_output_tensors(outputs));
+        assertSame(output, outputs[0]);
+        assertArrayEquals(expected, outputs[0].data(), 0.0f);
+
+        assertArrayEquals(input.data(), other.get_input_tensors()[0].data(), 0.0f);
+
+        // the getters without arguments return the same array every time
+        Tensor[] allOutputs = other.get_output_tensors();
+        assertSame(allOutputs, other.get_output_tensors());
+        assertSame(allOutputs[0], other.get_output_tensors()[0]);
+    }
+
+    @Test
+    public void testTensorByIndex() {
+        CompiledModel model = new Core().compile_model(modelXml, device);
+        InferRequest other = model.create_infer_request();
+        other.set_input_tensor(model.input_index("data"), input);
+        other.infer();
+
+        Tensor output = other.get_output_tensor(model.output_index("fc_out"));
+        assertArrayEquals(expected, output.data(), 0.0f);
+        assertArrayEquals(input.data(), other.get_input_tensor(0).data(), 0.0f);
+    }
+}
@@ -4,6 +4,9 @@ import static org.junit.Assert.*;
 
 import org.junit.Test;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.Arrays;
 
 public class TensorTests extends OVTest {
@@ -42,4 +45,48 @@ public class TensorTests extends OVTest {
         assertArrayEquals(dimsArr, tensor.get_shape());
         assertEquals(size, tensor.get_size());
     }
+
+    @Test
+    public void testGetTensorFromByteBuffer() {
+        ByteBuffer buffer =
+                ByteBuffer.allocateDirect(data.length * Float.BYTES).order(ByteOrder.nativeOrder());
+        buffer.asFloatBuffer().put(data);
+
+        Tensor tensor = new Tensor(ElementType.f32, dimsArr, buffer);
+
+        assertArrayEquals(dimsArr, tensor.get_shape());
+        assertArrayEquals(data, tensor.data(), 0.0f);
+
+        // memory is shared with the buffer
+        buffer.putFloat(0, 42.0f);
+        assertEquals(42.0f, tensor.data()[0], 0.0f);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testGetTensorFromHeapByteBuffer() {
+        new Tensor(ElementType.f32, dimsArr, ByteBuffer.allocate(data.length * Float.BYTES));
+    }
+
+    @Test(expected = Exception.class)
+    public void testGetTensorFromSmallByteBuffer() {
+        new Tensor(ElementType.f32, dimsArr, ByteBuffer.allocateDirect(Float.BYTES));
+    }
+
+    @Test
+    public void testAsByteBuffer() {
+        Tensor tensor = new Tensor(dimsArr, data);
+
+        ByteBuffer buffer = tensor.asByteBuffer();
+        assertTrue(buffer.isDirect());
+        assertEquals(data.length * Float.BYTES, buffer.capacity());
+
+        float[] result = new float[data.length];
+        FloatBuffer floats = buffer.asFloatBuffer();
+        floats.get(result);
+        assertArrayEquals(data, result, 0.0f);
+
+        // writes through the buffer are visible in the tensor
+        floats.put(1, 42.0f);
+        assertEquals(42.0f, tensor.data()[1], 0.0f);
+    }
 }
@@ -10,6 +10,11 @@
  */
 #pragma once
 
+#include <istream>
+#include <ostream>
+#include <string>
+
+#include "openvino/core/except.hpp"
 #include "openvino/runtime/properties.hpp"
 
 namespace ov {
@@ -34,5 +39,113 @@ static constexpr Property<bool, PropertyMutability::RW> use_cuda_graph{"NVIDIA_U
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_cuda_graphs{"NVIDIA_NUMBER_OF_CUDA_GRAPHS"};
 
+/**
+ * @brief Strategy of placing intermediate tensors in the mutable memory blob of an infer request
+ */
+enum class MemoryPlanner {
+    MEMORY_SOLVER = 0,      //!< OpenVINO MemorySolver
+    GREEDY_BY_SIZE = 1,     //!< Largest tensors first, each one to the smallest suitable gap
+    GREEDY_BY_BREADTH = 2,  //!< Tensors of the most memory-hungry operations first
+    BEST_FIT = 3,           //!< Allocation in execution order from the best fitting free block
+    EXACT = 4,              //!< Search for the smallest blob, for small graphs only
+    AUTO = 5,               //!< The smallest blob of all strategies applicable to the graph
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemoryPlanner& planner) {
+    switch (planner) {
+        case MemoryPlanner::MEMORY_SOLVER:
+            return os << "MEMORY_SOLVER";
+        case MemoryPlanner::GREEDY_BY_SIZE:
+            return os << "GREEDY_BY_SIZE";
+        case MemoryPlanner::GREEDY_BY_BREADTH:
+            return os << "GREEDY_BY_BREADTH";
+        case MemoryPlanner::BEST_FIT:
+            return os << "BEST_FIT";
+        case MemoryPlanner::EXACT:
+            return os << "EXACT";
+        case MemoryPlanner::AUTO:
+            return os << "AUTO";
+        default:
+            OPENVINO_THROW("Unsupported memory planner");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemoryPlanner& planner) {
+    std::string str;
+    is >> str;
+    if (str == "MEMORY_SOLVER") {
+        planner = MemoryPlanner::MEMORY_SOLVER;
+    } else if (str == "GREEDY_BY_SIZE") {
+        planner = MemoryPlanner::GREEDY_BY_SIZE;
+    } else if (str == "GREEDY_BY_BREADTH") {
+        planner = MemoryPlanner::GREEDY_BY_BREADTH;
+    } else if (str == "BEST_FIT") {
+        planner = MemoryPlanner::BEST_FIT;
+    } else if (str == "EXACT") {
+        planner = MemoryPlanner::EXACT;
+    } else if (str == "AUTO") {
+        planner = MemoryPlanner::AUTO;
+    } else {
+        OPENVINO_THROW("Unsupported memory planner: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines how intermediate tensors are placed in the mutable memory blob of an infer request.
+ * A smaller blob lets more infer requests fit in the device memory.
+ */
+static constexpr Property<MemoryPlanner, PropertyMutability::RW> memory_planner{"NVIDIA_MEMORY_PLANNER"};
+
+/**
+ * @brief Maximum number of device memory blocks for intermediate tensors the compiled model may allocate
+ * when more infer requests run at once. 0 means the number chosen at compilation, i.e. no growth
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> memory_pool_max_size{"NVIDIA_MEMORY_POOL_MAX_SIZE"};
+
+/**
+ * @brief Time in milliseconds after which an unused device memory block is released. 0 means never
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> memory_pool_idle_timeout{
+    "NVIDIA_MEMORY_POOL_IDLE_TIMEOUT"};
+
+/**
+ * @brief Read-only property showing number of currently allocated device memory blocks
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_size{"NVIDIA_MEMORY_POOL_SIZE"};
+
+/**
+ * @brief Read-only property showing maximum number of device memory blocks allocated at once
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_peak_size{"NVIDIA_MEMORY_POOL_PEAK_SIZE"};
+
+/**
+ * @brief Read-only property showing number of infer requests waiting for a device memory block
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_waiting_requests{
+    "NVIDIA_MEMORY_POOL_WAITING_REQUESTS"};
+
+/**
+ * @brief Read-only property showing number of device memory blocks requested at compilation
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_requested_size{
+    "NVIDIA_MEMORY_POOL_REQUESTED_SIZE"};
+
+/**
+ * @brief Read-only property showing number of device memory blocks allocated at compilation.
+ * It is less than the requested one if the device runs out of memory
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_allocated_size{
+    "NVIDIA_MEMORY_POOL_ALLOCATED_SIZE"};
+
+/**
+ * @brief Read-only property showing number of failed allocations of device memory blocks,
+ * both at compilation and on growth of the pool
+ */
+static constexpr Property<size_t, PropertyMutability::RO> memory_pool_failed_allocations{
+    "NVIDIA_MEMORY_POOL_FAILED_ALLOCATIONS"};
+
 }  // namespace nvidia_gpu
 }  // namespace ov
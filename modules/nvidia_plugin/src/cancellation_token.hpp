@@ -25,13 +25,25 @@ public:
      * Set token status as cancelled
      */
     void cancel() {
+        is_cancelled_.store(true, std::memory_order_release);
         if (cancel_callback_) {
             cancel_callback_();
         };
     }
 
+    /**
+     * Checks whether the token is cancelled since the last reset
+     */
+    bool is_cancelled() const { return is_cancelled_.load(std::memory_order_acquire); }
+
+    /**
+     * Clears cancelled status, so the token can be used for the next inference
+     */
+    void reset() { is_cancelled_.store(false, std::memory_order_release); }
+
 private:
     std::function<void()> cancel_callback_;
+    std::atomic<bool> is_cancelled_{false};
 };
 
 }  // namespace nvidia_gpu
@@ -123,7 +123,8 @@ void CompiledModel::compile_model(const std::shared_ptr<const ov::Model>& model)
 
     // Perform any other steps like allocation and filling backend specific memory handles and so on
     const bool opBenchOption = config_.get(ov::nvidia_gpu::operation_benchmark.name()).as<bool>();
-    const auto creationContext = CreationContext{device, opBenchOption};
+    const auto memoryPlanner = config_.get(ov::nvidia_gpu::memory_planner.name()).as<MemoryPlanner>();
+    const auto creationContext = CreationContext{device, opBenchOption, memoryPlanner};
 
     if (use_cuda_graph_) {
         auto cudaGraphTopologyRunner = std::make_unique<CudaGraphTopologyRunner>(creationContext, model_);
@@ -255,7 +256,9 @@ std::shared_ptr<MemoryPool> CompiledModel::create_memory_pool() {
     const auto& memory_model = memory_manager.mutableTensorsMemoryModel();
     const auto memory_blob_size = memory_model->deviceMemoryBlockSize();
     const auto num_streams = get_optimal_number_of_streams(const_blob_size + immutable_work_buffers_size, memory_blob_size);
-    return std::make_shared<MemoryPool>(num_streams, memory_model);
+    const auto max_size = config_.get(ov::nvidia_gpu::memory_pool_max_size.name()).as<uint32_t>();
+    const auto idle_timeout = config_.get(ov::nvidia_gpu::memory_pool_idle_timeout.name()).as<uint32_t>();
+    return std::make_shared<MemoryPool>(num_streams, memory_model, max_size, std::chrono::milliseconds{idle_timeout});
 }
 
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_benchmark_sync_infer_request() {
@@ -301,6 +304,18 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         supported_properties.push_back(ov::PropertyName(ov::loaded_from_cache.name(), PropertyMutability::RO));
         supported_properties.push_back(ov::PropertyName(ov::nvidia_gpu::number_of_cuda_graphs.name(),
                                        PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_peak_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_waiting_requests.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_requested_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_allocated_size.name(), PropertyMutability::RO));
+        supported_properties.push_back(
+            ov::PropertyName(ov::nvidia_gpu::memory_pool_failed_allocations.name(), PropertyMutability::RO));
         auto rw_properties = config_.get_rw_properties();
         for (auto& rw_property : rw_properties)
             supported_properties.emplace_back(ov::PropertyName(rw_property, PropertyMutability::RO));
@@ -317,6 +332,22 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::loaded_from_cache)::value_type{loaded_from_cache_};
     } else if (ov::nvidia_gpu::number_of_cuda_graphs == name) {
         return decltype(ov::nvidia_gpu::number_of_cuda_graphs)::value_type{number_of_cuda_graphs_};
+    } else if (ov::nvidia_gpu::memory_pool_size == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_size)::value_type{memory_pool_->GetStatistics().size};
+    } else if (ov::nvidia_gpu::memory_pool_peak_size == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_peak_size)::value_type{memory_pool_->GetStatistics().peak_size};
+    } else if (ov::nvidia_gpu::memory_pool_waiting_requests == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_waiting_requests)::value_type{
+            memory_pool_->GetStatistics().waiting};
+    } else if (ov::nvidia_gpu::memory_pool_requested_size == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_requested_size)::value_type{
+            memory_pool_->GetStatistics().requested_size};
+    } else if (ov::nvidia_gpu::memory_pool_allocated_size == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_allocated_size)::value_type{
+            memory_pool_->GetStatistics().allocated_size};
+    } else if (ov::nvidia_gpu::memory_pool_failed_allocations == name) {
+        return decltype(ov::nvidia_gpu::memory_pool_failed_allocations)::value_type{
+            memory_pool_->GetStatistics().failed_allocations};
     } else {
         return config_.get(name);
     }
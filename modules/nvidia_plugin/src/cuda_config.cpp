@@ -43,6 +43,9 @@ std::vector<ov::PropertyName> Configuration::get_rw_properties() {
         ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::nvidia_gpu::operation_benchmark.name(), ov::PropertyMutability::RW},
         ov::PropertyName{ov::nvidia_gpu::use_cuda_graph.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_planner.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_pool_max_size.name(), ov::PropertyMutability::RW},
+        ov::PropertyName{ov::nvidia_gpu::memory_pool_idle_timeout.name(), ov::PropertyMutability::RW},
     };
     return rw_properties;
 }
@@ -163,6 +166,12 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
             operation_benchmark = value.as<bool>();
         } else if (ov::nvidia_gpu::use_cuda_graph == key) {
             use_cuda_graph = value.as<bool>();
+        } else if (ov::nvidia_gpu::memory_planner == key) {
+            memory_planner = value.as<MemoryPlanner>();
+        } else if (ov::nvidia_gpu::memory_pool_max_size == key) {
+            memory_pool_max_size = value.as<uint32_t>();
+        } else if (ov::nvidia_gpu::memory_pool_idle_timeout == key) {
+            memory_pool_idle_timeout = value.as<uint32_t>();
         } else if (ov::enable_profiling == key) {
             is_profiling_enabled = value.as<bool>();
         } else if (ov::hint::num_requests == key) {
@@ -199,6 +208,12 @@ ov::Any Configuration::get(const std::string& name) const {
         return operation_benchmark;
     } else if (name == ov::nvidia_gpu::use_cuda_graph) {
         return use_cuda_graph;
+    } else if (name == ov::nvidia_gpu::memory_planner) {
+        return memory_planner;
+    } else if (name == ov::nvidia_gpu::memory_pool_max_size) {
+        return memory_pool_max_size;
+    } else if (name == ov::nvidia_gpu::memory_pool_idle_timeout) {
+        return memory_pool_idle_timeout;
     } else if (name == ov::num_streams) {
         return (num_streams == 0) ?
             ov::streams::Num(get_optimal_number_of_streams()) : num_streams;
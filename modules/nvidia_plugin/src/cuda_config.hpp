@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 
+#include "nvidia/properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
@@ -52,6 +53,9 @@ private:
     bool is_profiling_enabled = false;
     bool operation_benchmark = false;
     bool use_cuda_graph = true;
+    MemoryPlanner memory_planner = MemoryPlanner::MEMORY_SOLVER;
+    uint32_t memory_pool_max_size = 0;
+    uint32_t memory_pool_idle_timeout = 0;
     bool exclusive_async_requests = false;
     uint32_t hint_num_requests = 0;
     ov::streams::Num num_streams = 0;
@@ -10,6 +10,7 @@
 #include "transformer/nodes/fused_convolution.hpp"
 #include "transformer/nodes/fused_convolution_backprop_data.hpp"
 #include "transformer/nodes/lstm_sequence_optimized.hpp"
+#include "transformer/nodes/split_optimized.hpp"
 
 OPENVINO_CREATE_EXTENSIONS(
     std::vector<ov::Extension::Ptr>({
@@ -18,5 +19,6 @@ OPENVINO_CREATE_EXTENSIONS(
         std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::FusedConvBackpropData>>(),
         std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::FusedConvolution>>(),
         std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::FusedGroupConvolution>>(),
-        std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::LSTMSequenceOptimized>>()
+        std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::LSTMSequenceOptimized>>(),
+        std::make_shared<ov::OpExtension<ov::nvidia_gpu::nodes::SplitOptimized>>()
 }));
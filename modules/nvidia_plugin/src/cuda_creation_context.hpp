@@ -6,6 +6,8 @@
 
 #include <cuda_config.hpp>
 
+#include "nvidia/properties.hpp"
+
 #include "cuda/blas.hpp"
 #include "cuda/dnn.hpp"
 #include "cuda/tensor.hpp"
@@ -17,13 +19,17 @@ class CreationContext {
     CUDA::Device device_;
     CUDA::DnnHandle dnn_handle_;
     bool op_bench_option_;
+    MemoryPlanner memory_planner_;
 
 public:
-    explicit CreationContext(CUDA::Device d, bool opBenchOption)
-        : device_{d.setCurrent()}, op_bench_option_{opBenchOption} {}
+    explicit CreationContext(CUDA::Device d,
+                             bool opBenchOption,
+                             MemoryPlanner memoryPlanner = MemoryPlanner::MEMORY_SOLVER)
+        : device_{d.setCurrent()}, op_bench_option_{opBenchOption}, memory_planner_{memoryPlanner} {}
     CUDA::Device device() const { return device_; }
     const CUDA::DnnHandle& dnnHandle() const { return dnn_handle_; }
     bool opBenchOption() const noexcept { return op_bench_option_; }
+    MemoryPlanner memoryPlanner() const noexcept { return memory_planner_; }
 };
 
 }  // namespace nvidia_gpu
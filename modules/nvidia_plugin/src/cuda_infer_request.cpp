@@ -98,6 +98,7 @@ void CudaInferRequest::create_infer_request() {
 void CudaInferRequest::infer_preprocess() {
     OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::Preprocess]);
     executionDelegator_->start_stage();
+    cancellation_token_.reset();
 
     convert_batched_tensors();
     check_tensors();
@@ -151,7 +152,9 @@ void CudaInferRequest::start_pipeline(const ThreadContext& threadContext) {
         OV_ITT_SCOPED_TASK(itt::domains::nvidia_gpu, _profilingTask[PerfStages::StartPipeline])
         executionDelegator_->start_stage();
         auto compiled_model = get_nvidia_model();
-        memory_proxy_ = compiled_model->memory_pool_->WaitAndGet(cancellation_token_);
+        // The request prefers the memory block it used last time, which already has its CUDA graph captured,
+        // if that block is available. Under contention the request gets the first returned block
+        memory_proxy_ = compiled_model->memory_pool_->WaitAndGet(cancellation_token_, this);
         auto& memory = memory_proxy_->Get();
         auto& cudaGraphContext = memory.cudaGraphContext();
         auto& topology_runner = compiled_model->get_topology_runner();
@@ -6,6 +6,8 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cuda_operation_registry.hpp>
 #include <error.hpp>
 #include <gsl/span_ext>
 #include <openvino/op/constant.hpp>
@@ -17,6 +19,8 @@
 #include <openvino/op/unsqueeze.hpp>
 #include <stdexcept>
 #include <transformer/nodes/concat_optimized.hpp>
+#include <transformer/nodes/split_optimized.hpp>
+#include <unordered_set>
 #include <utility>
 
 namespace ov {
@@ -24,9 +28,11 @@ namespace nvidia_gpu {
 
 OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                                                      bool is_stable_params,
-                                                     bool is_stable_results)
+                                                     bool is_stable_results,
+                                                     bool is_in_place_enabled)
     : is_stable_params_{is_stable_params},
       is_stable_results_{is_stable_results},
+      is_in_place_enabled_{is_in_place_enabled},
       num_ordered_nodes_{static_cast<unsigned long>(ordered_nodes.size())} {
     for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
         const auto& node = ordered_nodes[node_idx];
@@ -38,6 +44,8 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             extractImmutableTensors(node);
         else if (IsConcatOptimizedNode(*node))
             mergeConcatMutableTensors(node, node_idx);
+        else if (IsSplitOptimizedNode(*node))
+            splitMutableTensors(node, node_idx);
         else if (isReshapeOnlyNode(*node))
             extractReshapeTensors(node, node_idx);
         else
@@ -63,6 +71,11 @@ OperationBuffersExtractor::OperationBuffersExtractor(gsl::span<const NodePtr> or
             }
         }
     }
+    if (is_in_place_enabled_) {
+        for (int node_idx = 0; node_idx < num_ordered_nodes_; node_idx++) {
+            placeOutputsInPlace(ordered_nodes[node_idx], node_idx);
+        }
+    }
 }
 
 std::vector<TensorID> OperationBuffersExtractor::inputTensorIds(const ov::Node& node) const {
@@ -178,6 +191,21 @@ void OperationBuffersExtractor::mergeConcatMutableTensors(const NodePtr& node, i
     OPENVINO_ASSERT(mergedTensorByteSize == totalSize);
 }
 
+void OperationBuffersExtractor::splitMutableTensors(const NodePtr& node, int node_idx) {
+    const auto& tensorId = tensor_names_.at(GetTensorNameInternal(node->input(0)));
+    size_t offset = 0;
+    for (const auto& output : node->outputs()) {
+        auto chunkTensor = std::make_shared<TensorID>(next_buffer_id_);
+        next_buffer_id_ += 1;
+        chunkTensor->SetParent(tensorId, offset);
+        tensor_names_.emplace(GetTensorNameInternal(output), chunkTensor);
+        const auto chunkByteSize = GetTensorByteSize(output);
+        mutable_tensor_sizes_[chunkTensor->GetId()] = chunkByteSize;
+        offset += chunkByteSize;
+    }
+    OPENVINO_ASSERT(offset == GetTensorByteSize(node->input(0)));
+}
+
 void OperationBuffersExtractor::extractReshapeTensors(const NodePtr& node, int node_idx) {
     try {
         OPENVINO_ASSERT(node->inputs().size() >= 1);
@@ -191,6 +219,49 @@ void OperationBuffersExtractor::extractReshapeTensors(const NodePtr& node, int n
     }
 }
 
+void OperationBuffersExtractor::placeOutputsInPlace(const NodePtr& node, int node_idx) {
+    const auto& inPlaceBuffers = OperationRegistry::getInstance().getInPlaceBuffers(*node);
+    std::unordered_set<BufferID> reusedBufferIds;
+    for (const auto& inPlace : inPlaceBuffers) {
+        if (inPlace.output >= node->get_output_size() || inPlace.input >= node->get_input_size()) {
+            continue;
+        }
+        const auto& output = node->output(inPlace.output);
+        const auto& input = node->input(inPlace.input);
+        const auto& outputTensor = tensor_names_.at(GetTensorNameInternal(output));
+        const auto& inputTensor = tensor_names_.at(GetTensorNameInternal(input));
+        const BufferID outputBufferId = outputTensor->GetId();
+        const BufferID inputBufferId = inputTensor->GetBuffer().GetId();
+        // The output should still own its buffer, e.g. it isn't merged by ConcatOptimized
+        if (&outputTensor->GetBuffer() != outputTensor.get() || mutable_buffers_.count(outputBufferId) == 0) {
+            continue;
+        }
+        const auto inputBuffer = mutable_buffers_.find(inputBufferId);
+        const auto outputByteSize = GetTensorByteSize(output);
+        if (inputBuffer == mutable_buffers_.end() || inputBuffer->second.lifespan_end != node_idx ||
+            inputBuffer->second.size != outputByteSize || inputTensor->GetOffset() != 0 ||
+            input.get_shape() != output.get_shape() || GetTensorByteSize(input) != outputByteSize ||
+            reusedBufferIds.count(inputBufferId) > 0) {
+            continue;
+        }
+        // Other inputs may read the same memory only at the same element indices
+        const auto inputs = node->inputs();
+        const bool isInputReadElsewhere = std::any_of(inputs.begin(), inputs.end(), [&](const auto& in) {
+            return in.get_index() != input.get_index() &&
+                   tensor_names_.at(GetTensorNameInternal(in))->GetBuffer().GetId() == inputBufferId &&
+                   in.get_shape() != output.get_shape();
+        });
+        if (isInputReadElsewhere) {
+            continue;
+        }
+        auto& outputBuffer = mutable_buffers_.at(outputBufferId);
+        inputBuffer->second.lifespan_end = std::max(inputBuffer->second.lifespan_end, outputBuffer.lifespan_end);
+        mutable_buffers_.erase(outputBufferId);
+        outputTensor->SetParent(inputTensor, 0);
+        reusedBufferIds.insert(inputBufferId);
+    }
+}
+
 void OperationBuffersExtractor::extractMutableTensors(const NodePtr& node, int node_idx) {
     for (const auto& output : node->outputs()) {
         auto tensorByteSize = GetTensorByteSize(output);
@@ -234,7 +305,7 @@ void OperationBuffersExtractor::extractResultTensors(const NodePtr& node) {
         auto input = node->inputs().front().get_source_output();
         const auto& tensorId = tensor_names_.at(GetTensorNameInternal(input));
         auto resultBuffer = std::find_if(mutable_buffers_.begin(), mutable_buffers_.end(), [&tensorId](const auto& mb) {
-            return mb.first == tensorId->GetId();
+            return mb.first == tensorId->GetBuffer().GetId();
         });
         if (resultBuffer == mutable_buffers_.end()) {
             throw_ov_exception(fmt::format("Cannot find mutable buffer for Result with name {}", node->get_name()));
@@ -288,8 +359,8 @@ MemoryModel::Ptr OperationBuffersExtractor::createConstantMemoryModel() const {
     return constants_block_builder.build();
 }
 
-MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel() const {
-    MemoryModelBuilder mutable_model_builder;
+MemoryModel::Ptr OperationBuffersExtractor::createMutableMemoryModel(MemoryPlanner planner) const {
+    MemoryModelBuilder mutable_model_builder{planner};
     for (auto id : mutableBuffersIds()) {
         mutable_model_builder.addAllocation(
             id, mutableBufferLifespanStart(id), mutableBufferLifespanEnd(id), mutableBufferSize(id));
@@ -322,6 +393,10 @@ bool OperationBuffersExtractor::IsConcatOptimizedNode(const ov::Node& node) {
     return dynamic_cast<const nodes::ConcatOptimized*>(&node) != nullptr;
 }
 
+bool OperationBuffersExtractor::IsSplitOptimizedNode(const ov::Node& node) {
+    return dynamic_cast<const nodes::SplitOptimized*>(&node) != nullptr;
+}
+
 bool OperationBuffersExtractor::isReshapeOnlyNode(const ov::Node& node) {
     return ov::is_type<const ov::op::v1::Reshape>(&node) || ov::is_type<const ov::op::v0::Squeeze>(&node) ||
            ov::is_type<const ov::op::v0::Unsqueeze>(&node);
@@ -37,11 +37,14 @@ public:
      * Nodes are ordered in their execution order.
      * @param [in] is_stable_params Makes input parameters alive for whole graph's life time
      * @param [in] is_stable_results Makes output results alive for till end of the graph's life time
+     * @param [in] is_in_place_enabled Places outputs of operations in the memory of their inputs
+     * where the operations declare it's possible and the inputs aren't used afterwards
      * @throws ov::Exception if the given subgraph is bad formed
      */
     OperationBuffersExtractor(gsl::span<const NodePtr> ordered_nodes,
                               bool is_stable_params = false,
-                              bool is_stable_results = false);
+                              bool is_stable_results = false,
+                              bool is_in_place_enabled = false);
 
     /**
      * Provides input tensors ids of the given ngraph node
@@ -133,9 +136,10 @@ public:
 
     /**
      * Create mutable memory model
+     * @param planner Strategy of placing mutable buffers in the memory blob
      * @return MemoryModel for mutable buffers
      */
-    MemoryModel::Ptr createMutableMemoryModel() const;
+    MemoryModel::Ptr createMutableMemoryModel(MemoryPlanner planner = MemoryPlanner::MEMORY_SOLVER) const;
 
     /**
      * Create immutable memory model
@@ -206,6 +210,23 @@ private:
      */
     void mergeConcatMutableTensors(const NodePtr& node, int node_idx);
 
+    /**
+     * Extracts output tensors of SplitOptimized node as sub-tensors of its input
+     * placed one after another, so they don't need own buffers
+     * @param node SplitOptimized node (custom node)
+     * @param node_idx Current node index
+     */
+    void splitMutableTensors(const NodePtr& node, int node_idx);
+
+    /**
+     * Places outputs of the given node in the memory of its inputs, where the node
+     * declares it in OperationRegistry and the input buffer isn't used after the node.
+     * Should be called in the execution order once lifespans of all buffers are known.
+     * @param node ngraph node which outputs to be placed in-place
+     * @param node_idx Current node index
+     */
+    void placeOutputsInPlace(const NodePtr& node, int node_idx);
+
     /**
      * Encapsulates immutable tensors extraction for the given node
      * @param node ngraph node from which tensors to be extracted
@@ -253,6 +274,11 @@ private:
      */
     static bool IsConcatOptimizedNode(const ov::Node& node);
 
+    /**
+     * Checks whether the given node is a SplitOptimized node (split optimized)
+     */
+    static bool IsSplitOptimizedNode(const ov::Node& node);
+
     /**
      * Exception helper
      */
@@ -272,6 +298,7 @@ private:
     unsigned next_buffer_id_{};
     const bool is_stable_params_ = false;
     const bool is_stable_results_ = false;
+    const bool is_in_place_enabled_ = false;
     const unsigned long num_ordered_nodes_ = 0;
 };
 
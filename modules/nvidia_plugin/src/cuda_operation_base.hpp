@@ -30,6 +30,16 @@ using DevicePointer = CUDA::DevicePointer<T>;
 
 enum class CudaGraphCompatibility { NONE, FULL, SPECIAL };
 
+/**
+ * Declares that the output of an operation may be placed in the memory of the input.
+ * The operation must produce a correct result when both pointers are equal, provided that
+ * the input has the same shape and byte size as the output.
+ */
+struct InPlaceBuffer {
+    std::size_t output;
+    std::size_t input;
+};
+
 class IOperationExec {
 public:
     using Inputs = gsl::span<const CUDA::DevicePointer<const void*>>;
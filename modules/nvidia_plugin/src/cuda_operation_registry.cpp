@@ -17,6 +17,17 @@ void OperationRegistry::registerOp(const std::string& opName, OperationBuilder&&
         throw std::runtime_error{"Operation " + opName + " is already registered !!"};
 }
 
+void OperationRegistry::registerInPlaceBuffers(const std::string& opName, std::vector<InPlaceBuffer>&& inPlaceBuffers) {
+    if (!registered_in_place_buffers_.try_emplace(opName, move(inPlaceBuffers)).second)
+        throw std::runtime_error{"In-place buffers of operation " + opName + " are already registered !!"};
+}
+
+const std::vector<InPlaceBuffer>& OperationRegistry::getInPlaceBuffers(const ov::Node& node) const {
+    static const std::vector<InPlaceBuffer> noInPlaceBuffers;
+    const auto found = registered_in_place_buffers_.find(node.get_type_info().name);
+    return found != registered_in_place_buffers_.end() ? found->second : noInPlaceBuffers;
+}
+
 bool OperationRegistry::hasOperation(const std::shared_ptr<ov::Node>& node) {
     return hasOperation(node->get_type_info().name);
 }
@@ -8,6 +8,7 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 #include "cuda_operation_base.hpp"
 #include "openvino/core/node.hpp"
@@ -43,6 +44,12 @@ template <typename TOperation>
 inline constexpr bool isConstructibleWithNodeOpRef =
     std::conditional_t<hasNodeOp<TOperation>, IsConstructibleWithNodeOpRef<TOperation>, std::false_type>::value;
 
+template <typename T, typename = void>
+inline constexpr auto hasInPlaceBuffers = false;
+
+template <typename T>
+inline constexpr auto hasInPlaceBuffers<T, std::void_t<decltype(T::kInPlaceBuffers)>> = true;
+
 }  // namespace details
 
 class OperationRegistry final {
@@ -73,6 +80,10 @@ public:
                     }
                 });
             getInstance().registerOpType<TOperation>(opName);
+            if constexpr (details::hasInPlaceBuffers<TOperation>) {
+                getInstance().registerInPlaceBuffers(
+                    opName, {std::begin(TOperation::kInPlaceBuffers), std::end(TOperation::kInPlaceBuffers)});
+            }
         }
     };
 
@@ -92,8 +103,16 @@ public:
                                        gsl::span<const TensorID> inIds,
                                        gsl::span<const TensorID> outIds);
 
+    /**
+     * Provides outputs of the operation which may be placed in the memory of its inputs
+     * @param node OpenVINO node of the operation
+     * @returns In-place declarations of the operation, empty if there are none
+     */
+    const std::vector<InPlaceBuffer>& getInPlaceBuffers(const ov::Node& node) const;
+
 private:
     void registerOp(const std::string& opName, OperationBuilder&& builder);
+    void registerInPlaceBuffers(const std::string& opName, std::vector<InPlaceBuffer>&& inPlaceBuffers);
     template <typename TOperation>
     void registerOpType(const std::string& opName) {
         if (!registered_type_operations_.try_emplace(opName, std::type_index(typeid(TOperation))).second) {
@@ -106,13 +125,19 @@ private:
     std::unordered_map<std::type_index, std::unordered_set<std::string>> type_registered_operations_;
     std::unordered_map<std::string, OperationBuilder> registered_operations_;
     std::unordered_map<std::string, std::type_index> registered_type_operations_;
+    std::unordered_map<std::string, std::vector<InPlaceBuffer>> registered_in_place_buffers_;
 };
 
 template <>
 class OperationRegistry::Register<OperationBase> {
 public:
-    explicit Register(const std::string& opName, OperationBuilder&& builder) {
+    explicit Register(const std::string& opName,
+                      OperationBuilder&& builder,
+                      std::vector<InPlaceBuffer>&& inPlaceBuffers = {}) {
         getInstance().registerOp(opName, move(builder));
+        if (!inPlaceBuffers.empty()) {
+            getInstance().registerInPlaceBuffers(opName, move(inPlaceBuffers));
+        }
     }
 };
 
@@ -128,6 +153,8 @@ public:
  *        2. type(const ov::Node&, IndexCollection&&, IndexCollection&&);
  *        3. type(const NodeOp&, IndexCollection&&, IndexCollection&&);
  *           where NodeOp is a type's inner alias for a concrete OpenVINO Node class
+ *        The type may declare a static constexpr array of InPlaceBuffer named kInPlaceBuffers
+ *        to let OperationBuffersExtractor place its outputs in the memory of its inputs
  * @param name - a textual operator's name
  */
 #define OPERATION_REGISTER(type, name)                                                                           \
@@ -141,3 +168,17 @@ public:
     [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Register<OperationBase> \
         openvino_cuda_op_register_##name{#name, factory};                               \
     }
+
+/**
+ * @macro OPERATION_REGISTER_FACTORY_IN_PLACE
+ * @brief Operator factory registration macro with in-place declarations
+ *
+ * @param factory - a function creating the operation
+ * @param name - a textual operator's name
+ * @param ... - InPlaceBuffer initializers, e.g. {0, 0}, which hold for every operation the factory creates
+ */
+#define OPERATION_REGISTER_FACTORY_IN_PLACE(factory, name, ...)                         \
+    extern "C" {                                                                        \
+    [[maybe_unused]] const ::ov::nvidia_gpu::OperationRegistry::Register<OperationBase> \
+        openvino_cuda_op_register_##name{#name, factory, {__VA_ARGS__}};                \
+    }
@@ -6,19 +6,27 @@
 
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <error.hpp>
+
 #include "model/cuda_memory_model.hpp"
 
 namespace ov {
 namespace nvidia_gpu {
 
-MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryModel) {
+MemoryPool::MemoryPool(const size_t num,
+                       std::shared_ptr<MemoryModel> memoryModel,
+                       const size_t maxSize,
+                       const std::chrono::milliseconds idleTimeout)
+    : memory_model_{std::move(memoryModel)},
+      configured_max_size_{maxSize},
+      idle_timeout_{idleTimeout} {
     memory_blocks_.reserve(num);
     try {
         for (int i = 0; i < num; ++i) {
-            memory_blocks_.push_back(std::make_unique<DeviceMemBlock>(memoryModel));
+            memory_blocks_.push_back({std::make_unique<DeviceMemBlock>(memory_model_)});
         }
     } catch (const std::exception& ex) {
-        // TODO: Added log message when logging mechanism will be supported
         /**
          * NOTE: It is not possible to allocate all memory of GPU that is why
          *       we allocate as much as possible
@@ -26,38 +34,168 @@ MemoryPool::MemoryPool(const size_t num, std::shared_ptr<MemoryModel> memoryMode
         if (memory_blocks_.empty()) {
             throw;
         }
+        failed_allocations_ = 1;
+        logError(fmt::format(
+            "MemoryPool allocated {} of {} DeviceMemBlock-s: {}", memory_blocks_.size(), num, ex.what()));
+    }
+    requested_size_ = num;
+    size_ = peak_size_ = nominal_size_ = allocated_size_ = memory_blocks_.size();
+    max_size_ = std::max(configured_max_size_, nominal_size_);
+    if (idle_timeout_ > std::chrono::milliseconds::zero()) {
+        idle_thread_ = std::thread{&MemoryPool::ReleaseIdleBlocks, this};
+    }
+}
+
+MemoryPool::~MemoryPool() {
+    {
+        std::lock_guard<std::mutex> lock{mtx_};
+        stopped_ = true;
+    }
+    idle_cond_var_.notify_one();
+    if (idle_thread_.joinable()) {
+        idle_thread_.join();
     }
 }
 
-void MemoryPool::Interrupt() { cond_var_.notify_all(); }
+void MemoryPool::Interrupt() {
+    std::lock_guard<std::mutex> lock{mtx_};
+    for (auto* waiter : waiters_) {
+        waiter->cond_var.notify_one();
+    }
+}
 
-MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken) {
+MemoryPool::Proxy MemoryPool::WaitAndGet(CancellationToken& cancellationToken, const void* owner) {
     std::unique_lock<std::mutex> lock{mtx_};
-    cond_var_.wait(lock, [this, &cancellationToken] {
-        return !memory_blocks_.empty();
+    // Nobody may take an available block ahead of the callers which are already waiting
+    if (waiters_.empty() && !memory_blocks_.empty()) {
+        return Proxy{shared_from_this(), TakeBlock(owner), owner};
+    }
+    Waiter waiter;
+    waiters_.push_back(&waiter);
+    if (memory_blocks_.empty() && size_ < max_size_) {
+        Grow(lock);
+    }
+    waiter.cond_var.wait(lock, [&waiter, &cancellationToken] {
+        return waiter.memory_block || cancellationToken.is_cancelled();
     });
-    Proxy memoryManagerProxy{shared_from_this(), move(memory_blocks_.back())};
-    memory_blocks_.pop_back();
-    return memoryManagerProxy;
+    if (!waiter.memory_block) {
+        waiters_.erase(std::find(waiters_.begin(), waiters_.end(), &waiter));
+        throw_ov_exception("Waiting for a device memory block is cancelled");
+    }
+    return Proxy{shared_from_this(), move(waiter.memory_block), owner};
 }
 
-size_t MemoryPool::Size() const { return memory_blocks_.size(); }
+size_t MemoryPool::Size() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return nominal_size_;
+}
 
 void MemoryPool::Resize(size_t count) {
-    const auto memoryManagersCount = memory_blocks_.size();
-    if (count > memoryManagersCount) {
-        throw_ov_exception(
-            fmt::format("Cannot resize MemoryPool with {} value > than it was {}", count, memoryManagersCount));
+    std::vector<Block> releasedBlocks;
+    std::lock_guard<std::mutex> lock{mtx_};
+    while (size_ > count && !memory_blocks_.empty()) {
+        releasedBlocks.push_back(std::move(memory_blocks_.back()));
+        memory_blocks_.pop_back();
+        --size_;
     }
-    memory_blocks_.resize(count);
+    nominal_size_ = count;
+    max_size_ = std::max(configured_max_size_, count);
 }
 
-void MemoryPool::PushBack(std::unique_ptr<DeviceMemBlock> memManager) {
-    {
-        std::lock_guard<std::mutex> lock{mtx_};
-        memory_blocks_.push_back(std::move(memManager));
+MemoryPool::Statistics MemoryPool::GetStatistics() const {
+    std::lock_guard<std::mutex> lock{mtx_};
+    return {size_, peak_size_, waiters_.size(), requested_size_, allocated_size_, failed_allocations_};
+}
+
+void MemoryPool::PushBack(std::unique_ptr<DeviceMemBlock> memManager, const void* owner) {
+    std::lock_guard<std::mutex> lock{mtx_};
+    Dispatch(std::move(memManager), owner);
+}
+
+void MemoryPool::Dispatch(std::unique_ptr<DeviceMemBlock> memManager, const void* owner) {
+    if (waiters_.empty()) {
+        memory_blocks_.push_back({std::move(memManager), owner});
+        return;
+    }
+    // The waiter is notified under the lock, as it may leave WaitAndGet right after getting the block
+    auto* waiter = waiters_.front();
+    waiters_.pop_front();
+    waiter->memory_block = std::move(memManager);
+    waiter->cond_var.notify_one();
+}
+
+void MemoryPool::Grow(std::unique_lock<std::mutex>& lock) {
+    // The block is counted before allocation, so concurrent callers don't exceed the maximum size
+    ++size_;
+    lock.unlock();
+    std::unique_ptr<DeviceMemBlock> memoryBlock;
+    try {
+        memoryBlock = std::make_unique<DeviceMemBlock>(memory_model_);
+    } catch (const std::exception& ex) {
+        logError(fmt::format("MemoryPool cannot allocate one more DeviceMemBlock: {}", ex.what()));
+    }
+    lock.lock();
+    if (!memoryBlock) {
+        --size_;
+        ++failed_allocations_;
+        return;
+    }
+    peak_size_ = std::max(peak_size_, size_);
+    Dispatch(std::move(memoryBlock), nullptr);
+}
+
+void MemoryPool::ReleaseIdleBlocks() {
+    try {
+        device_.setCurrent();
+    } catch (const std::exception& ex) {
+        logError(fmt::format("MemoryPool cannot release idle DeviceMemBlock-s: {}", ex.what()));
+        return;
+    }
+    std::unique_lock<std::mutex> lock{mtx_};
+    while (!stopped_) {
+        // Available blocks are ordered by the time they were returned, so the idle ones are in front
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<Block> idleBlocks;
+        while (size_ > 1 && !memory_blocks_.empty() && now - memory_blocks_.front().released_at >= idle_timeout_) {
+            idleBlocks.push_back(std::move(memory_blocks_.front()));
+            memory_blocks_.erase(memory_blocks_.begin());
+            --size_;
+        }
+        if (!idleBlocks.empty()) {
+            // Device memory is freed outside of the lock
+            lock.unlock();
+            idleBlocks.clear();
+            lock.lock();
+            continue;
+        }
+        const auto deadline =
+            memory_blocks_.empty() ? now + idle_timeout_ : memory_blocks_.front().released_at + idle_timeout_;
+        idle_cond_var_.wait_until(lock, deadline, [this] { return stopped_; });
+    }
+}
+
+std::unique_ptr<DeviceMemBlock> MemoryPool::TakeBlock(const void* owner) {
+    // The last returned block is used when affinity isn't requested. Otherwise the block of the same owner
+    // is preferred, then a never used one, then the least recently returned one, which owner is less likely
+    // to come back soon
+    auto block = std::prev(memory_blocks_.end());
+    if (owner != nullptr) {
+        auto findOwnedBy = [this](const void* key) {
+            return std::find_if(memory_blocks_.begin(), memory_blocks_.end(), [key](const auto& b) {
+                return b.owner == key;
+            });
+        };
+        block = findOwnedBy(owner);
+        if (block == memory_blocks_.end()) {
+            block = findOwnedBy(nullptr);
+        }
+        if (block == memory_blocks_.end()) {
+            block = memory_blocks_.begin();
+        }
     }
-    cond_var_.notify_one();
+    auto memoryBlock = std::move(block->memory_block);
+    memory_blocks_.erase(block);
+    return memoryBlock;
 }
 
 }  // namespace nvidia_gpu
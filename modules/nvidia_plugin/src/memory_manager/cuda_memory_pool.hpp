@@ -5,8 +5,12 @@
 #pragma once
 
 #include <cancellation_token.hpp>
+#include <chrono>
 #include <condition_variable>
+#include <cuda/runtime.hpp>
+#include <deque>
 #include <mutex>
+#include <thread>
 
 #include "memory_manager/cuda_memory_manager.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
@@ -20,7 +24,12 @@ namespace nvidia_gpu {
  * @brief MemoryPool provides currently available DeviceMemBlock.
  *
  * This class is an owner of bunch of DeviceMemBlock-s and provides on request
- * WaitAndGet currently available DeviceMemBlock from pool
+ * WaitAndGet currently available DeviceMemBlock from pool.
+ * When all blocks are in use, callers wait in FIFO order and a returned block
+ * is handed over directly to the longest waiting one.
+ * The pool is elastic: when all blocks are in use, a new DeviceMemBlock is allocated
+ * lazily up to the configured maximum size, and blocks staying unused longer than
+ * the idle timeout are released.
  */
 class MemoryPool : public std::enable_shared_from_this<MemoryPool> {
 public:
@@ -39,7 +48,7 @@ public:
          * Returns DeviceMemBlock to MemoryPool
          */
         ~Proxy() {
-            if (pool_) pool_->PushBack(move(memory_block_));
+            if (pool_) pool_->PushBack(move(memory_block_), owner_);
         }
 
         /**
@@ -53,50 +62,148 @@ public:
          * MemoryPool is needed for returning back DeviceMemBlock
          * @param pool MemoryPool that is an owner of DeviceMemBlock
          * @param memManager DeviceMemBlock that will be temporary used
+         * @param owner Key of the caller the DeviceMemBlock is returned with
          */
-        Proxy(std::shared_ptr<MemoryPool> pool, std::unique_ptr<DeviceMemBlock>&& memoryBlock)
-            : pool_{move(pool)}, memory_block_{move(memoryBlock)} {}
+        Proxy(std::shared_ptr<MemoryPool> pool,
+              std::unique_ptr<DeviceMemBlock>&& memoryBlock,
+              const void* owner = nullptr)
+            : pool_{move(pool)}, memory_block_{move(memoryBlock)}, owner_{owner} {}
 
     private:
         std::unique_ptr<DeviceMemBlock> memory_block_;
         std::shared_ptr<MemoryPool> pool_;
+        const void* owner_ = nullptr;
+    };
+
+    /**
+     * Current state of MemoryPool
+     */
+    struct Statistics {
+        size_t size;                ///< Number of allocated DeviceMemBlock-s, either available or in use
+        size_t peak_size;           ///< Maximum number of DeviceMemBlock-s allocated at once
+        size_t waiting;             ///< Number of callers waiting for DeviceMemBlock
+        size_t requested_size;      ///< Number of DeviceMemBlock-s requested on creation
+        size_t allocated_size;      ///< Number of DeviceMemBlock-s allocated on creation
+        size_t failed_allocations;  ///< Number of failed allocations of DeviceMemBlock, on creation and growth
     };
 
     /**
      * Creates MemoryPool that owns @num DeviceMemBlock-s
      * @param num Number of DeviceMemBlock-s in pool
-     * @param sharedConstantsBlob Blob with constants
      * @param memoryModel MemoryModel that is used by each DeviceMemBlock as a layout of memory blob
      *                    containing mutable/intermediate tensors".
-     * @param immutableWorkbufferMemory Blob for immutable workbuffers
+     * @param maxSize Maximum number of DeviceMemBlock-s the pool may grow to, 0 means @num
+     * @param idleTimeout Time after which an unused DeviceMemBlock is released, 0 means never.
+     *                    At least one DeviceMemBlock is always kept
+     * @throws ov::Exception if not even one DeviceMemBlock can be allocated
      */
-    MemoryPool(size_t num, std::shared_ptr<MemoryModel> memoryModel);
+    MemoryPool(size_t num,
+               std::shared_ptr<MemoryModel> memoryModel,
+               size_t maxSize = 0,
+               std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero());
+    ~MemoryPool();
 
     /**
-     * Interrupt waiting of DeviceMemBlock Proxy object
+     * Wakes up waiters of DeviceMemBlock Proxy object, so the cancelled ones stop waiting
      */
     void Interrupt();
     /**
      * Wait and return Proxy object
+     * @param cancellationToken Token which interrupts waiting once cancelled
+     * @param owner Optional key of the caller, e.g. infer request. Among available DeviceMemBlock-s
+     *              the one last used with the same key is preferred, so the CUDA graph captured in it
+     *              stays valid. A caller which has to wait gets the first returned DeviceMemBlock
+     *              regardless of the key
      * @return Proxy object through which we can access DeviceMemBlock
+     * @throws ov::Exception if the token is cancelled while waiting
      */
-    Proxy WaitAndGet(CancellationToken& cancellationToken);
+    Proxy WaitAndGet(CancellationToken& cancellationToken, const void* owner = nullptr);
 
+    /**
+     * Returns the nominal number of DeviceMemBlock-s, i.e. the number of infer requests
+     * which may run without waiting for DeviceMemBlock
+     */
     size_t Size() const;
+    /**
+     * Changes the nominal number of DeviceMemBlock-s. Available DeviceMemBlock-s above @count
+     * are released, missing ones are allocated on demand
+     * @param count New nominal number of DeviceMemBlock-s
+     */
     void Resize(size_t count);
 
+    Statistics GetStatistics() const;
+
 private:
     friend class ::MemoryPoolTest;
 
+    /**
+     * Available DeviceMemBlock and the key of its last user
+     */
+    struct Block {
+        std::unique_ptr<DeviceMemBlock> memory_block;
+        const void* owner = nullptr;
+        std::chrono::steady_clock::time_point released_at = std::chrono::steady_clock::now();
+    };
+
+    /**
+     * Caller waiting for DeviceMemBlock, lives on the stack of WaitAndGet
+     */
+    struct Waiter {
+        std::condition_variable cond_var;
+        std::unique_ptr<DeviceMemBlock> memory_block;
+    };
+
     /**
      * Move DeviceMemBlock back to pool
      * @param memManager DeviceMemBlock
+     * @param owner Key of the caller which used DeviceMemBlock
+     */
+    void PushBack(std::unique_ptr<DeviceMemBlock> memManager, const void* owner);
+
+    /**
+     * Takes one of available DeviceMemBlock-s, should be called under the lock
+     * @param owner Key of the caller
+     */
+    std::unique_ptr<DeviceMemBlock> TakeBlock(const void* owner);
+
+    /**
+     * Hands DeviceMemBlock over to the longest waiting caller or makes it available,
+     * should be called under the lock
+     * @param memManager DeviceMemBlock
+     * @param owner Key of the caller which used DeviceMemBlock
      */
-    void PushBack(std::unique_ptr<DeviceMemBlock> memManager);
+    void Dispatch(std::unique_ptr<DeviceMemBlock> memManager, const void* owner);
 
-    std::mutex mtx_;
-    std::condition_variable cond_var_;
-    std::vector<std::unique_ptr<DeviceMemBlock>> memory_blocks_;
+    /**
+     * Allocates one more DeviceMemBlock and dispatches it. The lock is released during allocation
+     * @param lock Lock of mtx_
+     */
+    void Grow(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Body of the thread releasing DeviceMemBlock-s which are unused longer than idle timeout
+     */
+    void ReleaseIdleBlocks();
+
+    const std::shared_ptr<MemoryModel> memory_model_;
+    const CUDA::Device device_;
+    const size_t configured_max_size_;
+    const std::chrono::milliseconds idle_timeout_;
+
+    mutable std::mutex mtx_;
+    std::deque<Waiter*> waiters_;
+    std::vector<Block> memory_blocks_;
+    size_t size_ = 0;
+    size_t peak_size_ = 0;
+    size_t nominal_size_ = 0;
+    size_t max_size_ = 0;
+    size_t requested_size_ = 0;
+    size_t allocated_size_ = 0;
+    size_t failed_allocations_ = 0;
+
+    bool stopped_ = false;
+    std::condition_variable idle_cond_var_;
+    std::thread idle_thread_;
 };
 
 }  // namespace nvidia_gpu
@@ -9,6 +9,8 @@
 namespace ov {
 namespace nvidia_gpu {
 
+MemoryModelBuilder::MemoryModelBuilder(MemoryPlanner planner) : planner_{planner} {}
+
 void MemoryModelBuilder::addAllocation(BufferID id, int producerIndex, int lastConsumerIndex, size_t bsize) {
     OPENVINO_ASSERT(bsize > 0, "Allocation size is zero!");  // Verify that allocation size isn't zero.
     auto res = offsets_.emplace(id, 0);
@@ -18,11 +20,10 @@ void MemoryModelBuilder::addAllocation(BufferID id, int producerIndex, int lastC
 }
 
 MemoryModel::Ptr MemoryModelBuilder::build() {
-    ov::MemorySolver solver{boxes_};
-    const size_t blob_size = solver.solve();
-    for (auto& pair : offsets_) pair.second = solver.get_offset(pair.first);
+    const MemoryPlan plan = planMemory(planner_, boxes_);
+    for (auto& pair : offsets_) pair.second = plan.offsets.at(pair.first);
 
-    return std::make_shared<MemoryModel>(blob_size, offsets_);
+    return std::make_shared<MemoryModel>(static_cast<size_t>(plan.size), offsets_);
 }
 
 }  // namespace nvidia_gpu
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "memory_manager/model/cuda_memory_model.hpp"
+#include "memory_manager/model/details/cuda_memory_planners.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 
 namespace ov {
@@ -16,6 +17,11 @@ namespace nvidia_gpu {
  */
 class MemoryModelBuilder {
 public:
+    /**
+     * @param [in] planner Strategy of placing the tensors in the memory blob.
+     */
+    explicit MemoryModelBuilder(MemoryPlanner planner = MemoryPlanner::MEMORY_SOLVER);
+
     /**
      * Defines a single tensor allocation.
      *
@@ -37,6 +43,7 @@ public:
     MemoryModel::Ptr build();
 
 private:
+    MemoryPlanner planner_;
     std::vector<ov::MemorySolver::Box> boxes_;
     std::unordered_map<BufferID, ptrdiff_t> offsets_;
 };
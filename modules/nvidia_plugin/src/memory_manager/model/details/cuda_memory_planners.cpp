@@ -0,0 +1,417 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cuda_memory_planners.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <utility>
+
+namespace ov {
+namespace nvidia_gpu {
+
+namespace {
+
+using Box = ov::MemorySolver::Box;
+
+constexpr size_t kExactPlannerMaxSteps = 1000000;
+
+int lifespanEnd(const Box& box) { return box.finish == -1 ? std::numeric_limits<int>::max() : box.finish; }
+
+bool overlapInTime(const Box& lhs, const Box& rhs) {
+    return lhs.start <= lifespanEnd(rhs) && rhs.start <= lifespanEnd(lhs);
+}
+
+int lastStepOf(const std::vector<Box>& boxes) {
+    int lastStep = 0;
+    for (const auto& box : boxes) {
+        lastStep = std::max({lastStep, box.start, box.finish});
+    }
+    return lastStep;
+}
+
+/**
+ * Offsets of boxes placed one by one in the given order. Each box goes to the smallest suitable gap between
+ * the placed boxes alive at the same time (best fit) or to the lowest one (first fit), or on top of them.
+ * Placed boxes are listed by the steps of their lifespans, so only the boxes alive at the same time are checked.
+ */
+class OrderedPlacement {
+public:
+    OrderedPlacement(const std::vector<Box>& boxes, bool bestFit)
+        : boxes_{boxes},
+          best_fit_{bestFit},
+          last_step_{lastStepOf(boxes)},
+          offsets_(boxes.size(), -1),
+          seen_(boxes.size(), 0),
+          by_step_(last_step_ + 1) {}
+
+    int64_t place(size_t index) {
+        const Box& box = boxes_[index];
+        const int end = box.finish == -1 ? last_step_ : box.finish;
+        ++stamp_;
+        conflicts_.clear();
+        for (int step = box.start; step <= end; ++step) {
+            for (size_t placed : by_step_[step]) {
+                if (seen_[placed] != stamp_) {
+                    seen_[placed] = stamp_;
+                    conflicts_.emplace_back(offsets_[placed], boxes_[placed].size);
+                }
+            }
+        }
+        std::sort(conflicts_.begin(), conflicts_.end());
+
+        int64_t top = 0;
+        int64_t offset = -1;
+        int64_t bestGap = std::numeric_limits<int64_t>::max();
+        for (const auto& conflict : conflicts_) {
+            const int64_t gap = conflict.first - top;
+            if (gap >= box.size && gap < bestGap) {
+                offset = top;
+                bestGap = gap;
+                if (!best_fit_) {
+                    break;
+                }
+            }
+            top = std::max(top, conflict.first + conflict.second);
+        }
+        if (offset < 0) {
+            offset = top;
+        }
+
+        offsets_[index] = offset;
+        placed_.push_back(index);
+        for (int step = box.start; step <= end; ++step) {
+            by_step_[step].push_back(index);
+        }
+        return offset + box.size;
+    }
+
+    void unplaceLast() {
+        const size_t index = placed_.back();
+        const Box& box = boxes_[index];
+        const int end = box.finish == -1 ? last_step_ : box.finish;
+        for (int step = box.start; step <= end; ++step) {
+            by_step_[step].pop_back();
+        }
+        offsets_[index] = -1;
+        placed_.pop_back();
+    }
+
+    MemoryPlan plan(int64_t size) const {
+        MemoryPlan plan;
+        plan.size = size;
+        for (size_t i = 0; i < boxes_.size(); ++i) {
+            plan.offsets[boxes_[i].id] = offsets_[i];
+        }
+        return plan;
+    }
+
+private:
+    const std::vector<Box>& boxes_;
+    bool best_fit_;
+    int last_step_;
+    std::vector<int64_t> offsets_;
+    std::vector<size_t> placed_;
+    std::vector<size_t> seen_;  // stamp of the last placement the box was checked for
+    size_t stamp_ = 0;
+    std::vector<std::vector<size_t>> by_step_;
+    std::vector<std::pair<int64_t, int64_t>> conflicts_;  // offset, size
+};
+
+MemoryPlan placeInOrder(const std::vector<Box>& boxes, const std::vector<size_t>& order) {
+    OrderedPlacement placement{boxes, true};
+    int64_t size = 0;
+    for (size_t index : order) {
+        size = std::max(size, placement.place(index));
+    }
+    return placement.plan(size);
+}
+
+MemoryPlan solveWithMemorySolver(const std::vector<Box>& boxes) {
+    ov::MemorySolver solver{boxes};
+    MemoryPlan plan;
+    plan.size = solver.solve();
+    for (const auto& box : boxes) {
+        plan.offsets[box.id] = solver.get_offset(static_cast<int>(box.id));
+    }
+    return plan;
+}
+
+/**
+ * Largest boxes first, ties are broken by longer lifespans.
+ */
+MemoryPlan planGreedyBySize(const std::vector<Box>& boxes) {
+    std::vector<size_t> order(boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&boxes](size_t lhs, size_t rhs) {
+        const Box& l = boxes[lhs];
+        const Box& r = boxes[rhs];
+        if (l.size != r.size) {
+            return l.size > r.size;
+        }
+        return static_cast<int64_t>(lifespanEnd(l)) - l.start > static_cast<int64_t>(lifespanEnd(r)) - r.start;
+    });
+    return placeInOrder(boxes, order);
+}
+
+/**
+ * Execution steps are visited from the one with the largest total size of alive boxes (breadth),
+ * boxes of each step are placed from the largest one. A box is placed at the first visited step of its lifespan.
+ */
+MemoryPlan planGreedyByBreadth(const std::vector<Box>& boxes) {
+    const int lastStep = lastStepOf(boxes);
+    const size_t numSteps = static_cast<size_t>(lastStep) + 1;
+
+    std::vector<int64_t> breadth(numSteps + 1, 0);
+    for (const auto& box : boxes) {
+        const int end = box.finish == -1 ? lastStep : box.finish;
+        breadth[box.start] += box.size;
+        breadth[end + 1] -= box.size;
+    }
+    for (size_t step = 1; step < numSteps; ++step) {
+        breadth[step] += breadth[step - 1];
+    }
+
+    std::vector<size_t> steps(numSteps);
+    std::iota(steps.begin(), steps.end(), 0);
+    std::stable_sort(
+        steps.begin(), steps.end(), [&breadth](size_t lhs, size_t rhs) { return breadth[lhs] > breadth[rhs]; });
+    std::vector<size_t> rank(numSteps);
+    for (size_t i = 0; i < numSteps; ++i) {
+        rank[steps[i]] = i;
+    }
+
+    // Sparse table of minimal ranks, so the first visited step of a lifespan is found in constant time
+    std::vector<std::vector<size_t>> minRank{rank};
+    for (size_t width = 2; width <= numSteps; width *= 2) {
+        const auto& prev = minRank.back();
+        std::vector<size_t> next(numSteps - width + 1);
+        for (size_t i = 0; i < next.size(); ++i) {
+            next[i] = std::min(prev[i], prev[i + width / 2]);
+        }
+        minRank.push_back(std::move(next));
+    }
+    auto firstVisitedRank = [&](const Box& box) {
+        const size_t begin = box.start;
+        const size_t end = (box.finish == -1 ? lastStep : box.finish) + 1;
+        size_t level = 0;
+        while ((size_t{2} << level) <= end - begin) {
+            ++level;
+        }
+        return std::min(minRank[level][begin], minRank[level][end - (size_t{1} << level)]);
+    };
+
+    std::vector<size_t> boxRank(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        boxRank[i] = firstVisitedRank(boxes[i]);
+    }
+    std::vector<size_t> order(boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        if (boxRank[lhs] != boxRank[rhs]) {
+            return boxRank[lhs] < boxRank[rhs];
+        }
+        return boxes[lhs].size > boxes[rhs].size;
+    });
+    return placeInOrder(boxes, order);
+}
+
+/**
+ * Replays allocations and releases in execution order. Free blocks are kept in two trees: by offset
+ * to merge neighbours on release and by size to take the smallest suitable block on allocation.
+ * When no block fits, the blob grows, reusing the free block at its top if there is one.
+ */
+MemoryPlan planBestFit(const std::vector<Box>& boxes) {
+    std::vector<size_t> order(boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&boxes](size_t lhs, size_t rhs) {
+        if (boxes[lhs].start != boxes[rhs].start) {
+            return boxes[lhs].start < boxes[rhs].start;
+        }
+        return boxes[lhs].size > boxes[rhs].size;
+    });
+
+    std::map<int64_t, int64_t> freeByOffset;          // offset -> size
+    std::set<std::pair<int64_t, int64_t>> freeBySize;  // size, offset
+    int64_t top = 0;
+
+    auto release = [&](int64_t offset, int64_t size) {
+        auto next = freeByOffset.lower_bound(offset);
+        if (next != freeByOffset.end() && offset + size == next->first) {
+            size += next->second;
+            freeBySize.erase({next->second, next->first});
+            next = freeByOffset.erase(next);
+        }
+        if (next != freeByOffset.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset) {
+                offset = prev->first;
+                size += prev->second;
+                freeBySize.erase({prev->second, prev->first});
+                freeByOffset.erase(prev);
+            }
+        }
+        freeByOffset.emplace(offset, size);
+        freeBySize.emplace(size, offset);
+    };
+
+    auto allocate = [&](int64_t size) {
+        auto block = freeBySize.lower_bound({size, std::numeric_limits<int64_t>::min()});
+        if (block != freeBySize.end()) {
+            const int64_t offset = block->second;
+            const int64_t rest = block->first - size;
+            freeBySize.erase(block);
+            freeByOffset.erase(offset);
+            if (rest > 0) {
+                freeByOffset.emplace(offset + size, rest);
+                freeBySize.emplace(rest, offset + size);
+            }
+            return offset;
+        }
+        if (!freeByOffset.empty()) {
+            auto last = std::prev(freeByOffset.end());
+            if (last->first + last->second == top) {
+                const int64_t offset = last->first;
+                freeBySize.erase({last->second, last->first});
+                freeByOffset.erase(last);
+                top = offset + size;
+                return offset;
+            }
+        }
+        const int64_t offset = top;
+        top += size;
+        return offset;
+    };
+
+    using Allocation = std::pair<int, size_t>;  // lifespan end, box index
+    std::priority_queue<Allocation, std::vector<Allocation>, std::greater<Allocation>> alive;
+    MemoryPlan plan;
+    for (size_t index : order) {
+        const Box& box = boxes[index];
+        while (!alive.empty() && alive.top().first < box.start) {
+            const Box& released = boxes[alive.top().second];
+            release(plan.offsets[released.id], released.size);
+            alive.pop();
+        }
+        plan.offsets[box.id] = allocate(box.size);
+        alive.emplace(lifespanEnd(box), index);
+    }
+    plan.size = top;
+    return plan;
+}
+
+/**
+ * Plan of the smallest blob among the heuristics.
+ */
+MemoryPlan planAuto(const std::vector<Box>& boxes) {
+    MemoryPlan best = solveWithMemorySolver(boxes);
+    for (auto planner : {planGreedyBySize, planGreedyByBreadth, planBestFit}) {
+        MemoryPlan plan = planner(boxes);
+        if (plan.size < best.size) {
+            best = std::move(plan);
+        }
+    }
+    return best;
+}
+
+/**
+ * Branch and bound over the orders of first fit placement. The offsets of any plan are reproduced or lowered
+ * by placing its boxes from the lowest one to the first suitable gap, so some order gives the smallest blob.
+ * The search starts from the best heuristic plan and stops when the blob reaches the largest breadth,
+ * which no plan can beat, or after kExactPlannerMaxSteps placements.
+ */
+MemoryPlan planExact(const std::vector<Box>& boxes) {
+    MemoryPlan best = planAuto(boxes);
+    if (boxes.size() > kExactPlannerMaxBoxes) {
+        return best;
+    }
+
+    int64_t lowerBound = 0;
+    for (const auto& box : boxes) {
+        int64_t breadth = 0;
+        for (const auto& other : boxes) {
+            if (other.start <= box.start && box.start <= lifespanEnd(other)) {
+                breadth += other.size;
+            }
+        }
+        lowerBound = std::max(lowerBound, breadth);
+    }
+
+    OrderedPlacement placement{boxes, false};
+    std::vector<bool> placed(boxes.size(), false);
+    size_t steps = 0;
+    std::function<void(size_t, int64_t)> search = [&](size_t depth, int64_t size) {
+        if (depth == boxes.size()) {
+            best = placement.plan(size);
+            return;
+        }
+        for (size_t i = 0; i < boxes.size() && best.size > lowerBound && steps < kExactPlannerMaxSteps; ++i) {
+            if (placed[i]) {
+                continue;
+            }
+            ++steps;
+            const int64_t newSize = std::max(size, placement.place(i));
+            if (newSize < best.size) {
+                placed[i] = true;
+                search(depth + 1, newSize);
+                placed[i] = false;
+            }
+            placement.unplaceLast();
+        }
+    };
+    search(0, 0);
+    return best;
+}
+
+}  // namespace
+
+MemoryPlan planMemory(MemoryPlanner planner, const std::vector<ov::MemorySolver::Box>& boxes) {
+    if (boxes.empty()) {
+        return {};
+    }
+    switch (planner) {
+        case MemoryPlanner::MEMORY_SOLVER:
+            return solveWithMemorySolver(boxes);
+        case MemoryPlanner::GREEDY_BY_SIZE:
+            return planGreedyBySize(boxes);
+        case MemoryPlanner::GREEDY_BY_BREADTH:
+            return planGreedyByBreadth(boxes);
+        case MemoryPlanner::BEST_FIT:
+            return planBestFit(boxes);
+        case MemoryPlanner::EXACT:
+            return planExact(boxes);
+        case MemoryPlanner::AUTO:
+            return planAuto(boxes);
+        default:
+            OPENVINO_THROW("Unsupported memory planner");
+    }
+}
+
+bool isValidMemoryPlan(const MemoryPlan& plan, const std::vector<ov::MemorySolver::Box>& boxes) {
+    std::vector<int64_t> offsets;
+    for (const auto& box : boxes) {
+        const auto offset = plan.offsets.find(box.id);
+        if (offset == plan.offsets.end() || offset->second < 0 || offset->second + box.size > plan.size) {
+            return false;
+        }
+        offsets.push_back(offset->second);
+    }
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            if (overlapInTime(boxes[i], boxes[j]) && offsets[i] < offsets[j] + boxes[j].size &&
+                offsets[j] < offsets[i] + boxes[i].size) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace nvidia_gpu
+}  // namespace ov
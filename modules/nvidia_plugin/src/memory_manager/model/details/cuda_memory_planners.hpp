@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "nvidia/properties.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov {
+namespace nvidia_gpu {
+
+/**
+ * Placement of buffers in a memory blob.
+ */
+struct MemoryPlan {
+    int64_t size = 0;
+    std::unordered_map<int64_t, int64_t> offsets;  // by box id
+};
+
+/**
+ * Places lifespan boxes in a memory blob, so that boxes alive at the same time don't overlap.
+ *
+ * @param [in] planner Placement strategy.
+ * @param [in] boxes Boxes with unique ids. Box lifespan includes both start and finish,
+ * finish equal to -1 means "till to end".
+ * @returns Blob size and offsets of all boxes. Offsets are sums of box sizes,
+ * so they keep the allignment of sizes.
+ */
+MemoryPlan planMemory(MemoryPlanner planner, const std::vector<ov::MemorySolver::Box>& boxes);
+
+/**
+ * Checks that boxes alive at the same time don't overlap in the plan and fit in it.
+ */
+bool isValidMemoryPlan(const MemoryPlan& plan, const std::vector<ov::MemorySolver::Box>& boxes);
+
+/**
+ * Maximal number of boxes MemoryPlanner::EXACT searches the best placement for.
+ * Larger graphs are planned as with MemoryPlanner::AUTO.
+ */
+constexpr size_t kExactPlannerMaxBoxes = 16;
+
+}  // namespace nvidia_gpu
+}  // namespace ov
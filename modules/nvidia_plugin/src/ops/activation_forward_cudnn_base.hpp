@@ -6,6 +6,7 @@
 
 #include <cudnn_ops_infer.h>
 
+#include <array>
 #include <cuda/dnn.hpp>
 #include <cuda_operation_base.hpp>
 #include <initializer_list>
@@ -16,6 +17,8 @@ namespace nvidia_gpu {
 class ActivationForwardCuDnnOpBase : public OperationCuDnn {
 public:
     static constexpr std::size_t max_shape_size = 5;
+    // cudnnActivationForward() allows x and y to point to the same memory
+    static constexpr std::array<InPlaceBuffer, 1> kInPlaceBuffers{{{0, 0}}};
 
     static constexpr std::initializer_list<cudnnDataType_t> supported_types{
         CUDNN_DATA_FLOAT, CUDNN_DATA_DOUBLE, CUDNN_DATA_HALF, CUDNN_DATA_INT8};
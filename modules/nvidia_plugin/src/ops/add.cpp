@@ -40,7 +40,7 @@ static OperationBase::Ptr addFactory(const CreationContext& context,
     throw_ov_exception(fmt::format("Add node is not supported:\n{}", exception_msg.str()));
 }
 
-OPERATION_REGISTER_FACTORY(addFactory, Add)
+OPERATION_REGISTER_FACTORY_IN_PLACE(addFactory, Add, {0, 0}, {0, 1})
 
 }  // namespace nvidia_gpu
 }  // namespace ov
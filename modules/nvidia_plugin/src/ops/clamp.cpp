@@ -52,7 +52,7 @@ static OperationBase::Ptr clampFactory(const CreationContext& context,
     throw_ov_exception(fmt::format("Clamp node is not supported:\n{}", exception_msg.str()));
 }
 
-OPERATION_REGISTER_FACTORY(clampFactory, Clamp)
+OPERATION_REGISTER_FACTORY_IN_PLACE(clampFactory, Clamp, {0, 0})
 
 }  // namespace nvidia_gpu
 }  // namespace ov
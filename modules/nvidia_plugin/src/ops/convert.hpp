@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cuda/runtime.hpp>
 #include <cuda_operation_base.hpp>
 
@@ -14,6 +15,8 @@ namespace nvidia_gpu {
 
 class ConvertOp : public OperationBase {
 public:
+    static constexpr std::array<InPlaceBuffer, 1> kInPlaceBuffers{{{0, 0}}};
+
     ConvertOp(const CreationContext& context,
               const std::shared_ptr<ov::Node>& node,
               IndexCollection&& inputIds,
@@ -28,7 +28,7 @@ static OperationBase::Ptr divideFactory(const CreationContext& context,
         context, *node, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
 }
 
-OPERATION_REGISTER_FACTORY(divideFactory, Divide)
+OPERATION_REGISTER_FACTORY_IN_PLACE(divideFactory, Divide, {0, 0}, {0, 1})
 
 }  // namespace nvidia_gpu
 }  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cuda_operation_base.hpp>
 
 #include "components/numpy_broadcast_params.h"
@@ -16,6 +17,7 @@ template <typename nGraphNode, typename Kernel>
 class ElementwiseBinaryOp : public OperationBase {
 public:
     using NodeOp = nGraphNode;
+    static constexpr std::array<InPlaceBuffer, 2> kInPlaceBuffers{{{0, 0}, {0, 1}}};
     ElementwiseBinaryOp(const CreationContext& context,
                         const NodeOp& node,
                         IndexCollection&& inputIds,
@@ -32,7 +32,7 @@ static OperationBase::Ptr gelu_factory(const CreationContext& context,
         context, *node_v0, OperationBase::IndexCollection{inputs}, OperationBase::IndexCollection{outputs});
 }
 
-OPERATION_REGISTER_FACTORY(gelu_factory, Gelu)
+OPERATION_REGISTER_FACTORY_IN_PLACE(gelu_factory, Gelu, {0, 0})
 
 }  // namespace nvidia_gpu
 }  // namespace ov
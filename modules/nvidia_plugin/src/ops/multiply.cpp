@@ -40,7 +40,7 @@ static OperationBase::Ptr multiplyFactory(const CreationContext& context,
     throw_ov_exception(fmt::format("Multiply node is not supported:\n{}", exception_msg.str()));
 }
 
-OPERATION_REGISTER_FACTORY(multiplyFactory, Multiply)
+OPERATION_REGISTER_FACTORY_IN_PLACE(multiplyFactory, Multiply, {0, 0}, {0, 1})
 
 }  // namespace nvidia_gpu
 }  // namespace ov
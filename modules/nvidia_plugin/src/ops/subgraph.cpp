@@ -56,7 +56,8 @@ void SubGraph::initExecuteSequence(bool isStableParams, bool isStableResults) {
     const auto& orderedNodes = model_->get_ordered_ops();
 
     std::vector<Ptr> init_sequence{};
-    OperationBuffersExtractor opBuffersExtractor{orderedNodes, isStableParams, isStableResults};
+    static constexpr bool isInPlaceEnabled = true;
+    OperationBuffersExtractor opBuffersExtractor{orderedNodes, isStableParams, isStableResults, isInPlaceEnabled};
     const auto paramSize = model_->get_parameters().size();
     params_ = std::vector<OperationBase::Ptr>(paramSize);
     params_info_ = std::vector<OperationInfo>(paramSize);
@@ -98,14 +99,15 @@ void SubGraph::initExecuteSequence(bool isStableParams, bool isStableResults) {
         }
         exec_sequence_.push_back(operation);
     }
-    memory_manager_ = createMemoryManager(opBuffersExtractor);
+    memory_manager_ = createMemoryManager(opBuffersExtractor, creation_context_.memoryPlanner());
     initSharedImmutableWorkbuffers(init_sequence);
 }
 
-std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor) {
+std::unique_ptr<MemoryManager> SubGraph::createMemoryManager(const OperationBuffersExtractor& opBuffersExtractor,
+                                                             MemoryPlanner planner) {
     // Build memory model for mutable memory block
     auto constants_model = opBuffersExtractor.createConstantMemoryModel();
-    auto memory_model = opBuffersExtractor.createMutableMemoryModel();
+    auto memory_model = opBuffersExtractor.createMutableMemoryModel(planner);
     auto immutable_workbuffer_model = opBuffersExtractor.createImmutableMemoryModel();
 
     // Build shared constants memory block
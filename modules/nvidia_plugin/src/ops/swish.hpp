@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <cuda_operation_base.hpp>
 #include <openvino/op/swish.hpp>
 
@@ -14,6 +15,8 @@ namespace nvidia_gpu {
 
 class SwishOp : public OperationBase {
 public:
+    static constexpr std::array<InPlaceBuffer, 1> kInPlaceBuffers{{{0, 0}}};
+
     SwishOp(const CreationContext& context,
             const ov::Node& node,
             IndexCollection&& inputIds,
@@ -0,0 +1,26 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/op/variadic_split.hpp>
+
+namespace ov::nvidia_gpu::nodes {
+
+/**
+ * VariadicSplit which outputs are views of contiguous chunks of its input.
+ * It's created only when all dimensions above the split axis are 1.
+ */
+class SplitOptimized : public ov::op::v1::VariadicSplit {
+public:
+    using ov::op::v1::VariadicSplit::VariadicSplit;
+
+    OPENVINO_OP("SplitOptimized", "nvidia_gpu", ov::op::v1::VariadicSplit);
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        check_new_args_count(this, new_args);
+        return std::make_shared<SplitOptimized>(new_args.at(0), new_args.at(1), new_args.at(2));
+    }
+};
+}  // namespace ov::nvidia_gpu::nodes
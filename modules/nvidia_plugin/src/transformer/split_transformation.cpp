@@ -0,0 +1,271 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/cc/pass/itt.hpp"
+#include "split_transformation.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/split.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/strided_slice.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/variadic_split.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+#include "nodes/concat_optimized.hpp"
+#include "nodes/split_optimized.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace ov::nvidia_gpu::pass {
+namespace {
+using ov::nvidia_gpu::nodes::ConcatOptimized;
+using ov::nvidia_gpu::nodes::SplitOptimized;
+
+/**
+ * Range [begin, end) of the axis taken by a slicing node
+ */
+struct AxisRange {
+    size_t axis;
+    int64_t begin;
+    int64_t end;
+};
+
+std::shared_ptr<ov::op::v0::Constant> get_constant(const ov::Node& node, size_t input_idx) {
+    return ov::as_type_ptr<ov::op::v0::Constant>(node.get_input_node_shared_ptr(input_idx));
+}
+
+std::optional<size_t> get_axis(const ov::Node& node, size_t input_idx) {
+    const auto axis_const = get_constant(node, input_idx);
+    if (!axis_const || ov::shape_size(axis_const->get_shape()) != 1) {
+        return std::nullopt;
+    }
+    const auto rank = static_cast<int64_t>(node.get_input_shape(0).size());
+    int64_t axis = axis_const->cast_vector<int64_t>().front();
+    if (axis < 0) {
+        axis += rank;
+    }
+    if (axis < 0 || axis >= rank) {
+        return std::nullopt;
+    }
+    return axis;
+}
+
+/**
+ * Chunks along the axis are contiguous in memory only if all dimensions above the axis are 1
+ */
+bool is_outer_axis(const ov::Shape& shape, size_t axis) {
+    return std::all_of(shape.begin(), shape.begin() + axis, [](size_t dim) { return dim == 1; });
+}
+
+/**
+ * ConcatOptimized merges buffers of its inputs, so they can't be views of another buffer
+ */
+bool is_read_by_concat_optimized(const ov::Output<ov::Node>& output) {
+    for (const auto& in : output.get_target_inputs()) {
+        const auto* consumer = in.get_node();
+        if (ov::is_type<ConcatOptimized>(consumer)) {
+            return true;
+        }
+        if (ov::is_type<ov::op::v1::Reshape>(consumer) || ov::is_type<ov::op::v0::Squeeze>(consumer) ||
+            ov::is_type<ov::op::v0::Unsqueeze>(consumer)) {
+            if (is_read_by_concat_optimized(consumer->output(0))) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool is_mask_set(const std::vector<int64_t>& mask, size_t idx) { return idx < mask.size() && mask[idx] == 1; }
+
+std::optional<AxisRange> get_strided_slice_range(const ov::op::v1::StridedSlice& slice) {
+    const auto begin_const = get_constant(slice, 1);
+    const auto end_const = get_constant(slice, 2);
+    const auto stride_const = slice.get_input_size() > 3 ? get_constant(slice, 3) : nullptr;
+    if (!begin_const || !end_const || (slice.get_input_size() > 3 && !stride_const)) {
+        return std::nullopt;
+    }
+    const auto& new_axis_mask = slice.get_new_axis_mask();
+    const auto& ellipsis_mask = slice.get_ellipsis_mask();
+    if (std::any_of(new_axis_mask.begin(), new_axis_mask.end(), [](auto v) { return v != 0; }) ||
+        std::any_of(ellipsis_mask.begin(), ellipsis_mask.end(), [](auto v) { return v != 0; })) {
+        return std::nullopt;
+    }
+    const auto begins = begin_const->cast_vector<int64_t>();
+    const auto ends = end_const->cast_vector<int64_t>();
+    const auto strides =
+        stride_const ? stride_const->cast_vector<int64_t>() : std::vector<int64_t>(begins.size(), 1);
+    const auto& shape = slice.get_input_shape(0);
+    if (begins.size() > shape.size() || ends.size() != begins.size() || strides.size() != begins.size()) {
+        return std::nullopt;
+    }
+
+    std::optional<AxisRange> range;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        const auto dim = static_cast<int64_t>(shape[i]);
+        int64_t begin = 0;
+        int64_t end = dim;
+        if (i < begins.size()) {
+            if (is_mask_set(slice.get_shrink_axis_mask(), i)) {
+                begin = begins[i] < 0 ? begins[i] + dim : begins[i];
+                if (begin < 0 || begin >= dim) {
+                    return std::nullopt;
+                }
+                end = begin + 1;
+            } else {
+                if (strides[i] != 1) {
+                    return std::nullopt;
+                }
+                if (!is_mask_set(slice.get_begin_mask(), i)) {
+                    begin = std::clamp(begins[i] < 0 ? begins[i] + dim : begins[i], int64_t{0}, dim);
+                }
+                if (!is_mask_set(slice.get_end_mask(), i)) {
+                    end = std::clamp(ends[i] < 0 ? ends[i] + dim : ends[i], int64_t{0}, dim);
+                }
+            }
+        }
+        if (begin == 0 && end == dim) {
+            continue;
+        }
+        if (range || end <= begin || !is_outer_axis(shape, i)) {
+            return std::nullopt;
+        }
+        range = AxisRange{i, begin, end};
+    }
+    return range;
+}
+
+std::optional<AxisRange> get_gather_range(const ov::op::util::GatherBase& gather) {
+    const auto indices_const = get_constant(gather, 1);
+    const auto axis = get_axis(gather, 2);
+    if (!indices_const || !axis || gather.get_batch_dims() != 0) {
+        return std::nullopt;
+    }
+    const auto dim = static_cast<int64_t>(gather.get_input_shape(0)[*axis]);
+    auto indices = indices_const->cast_vector<int64_t>();
+    if (indices.empty()) {
+        return std::nullopt;
+    }
+    for (size_t i = 0; i < indices.size(); ++i) {
+        const int64_t index = indices[i] < 0 ? indices[i] + dim : indices[i];
+        if (index < 0 || index >= dim || (i > 0 && index != indices[0] + static_cast<int64_t>(i))) {
+            return std::nullopt;
+        }
+        indices[i] = index;
+    }
+    const int64_t begin = indices.front();
+    const int64_t end = begin + static_cast<int64_t>(indices.size());
+    if ((begin == 0 && end == dim) || !is_outer_axis(gather.get_input_shape(0), *axis)) {
+        return std::nullopt;
+    }
+    return AxisRange{*axis, begin, end};
+}
+
+std::shared_ptr<SplitOptimized> make_split_optimized(const ov::Output<ov::Node>& data,
+                                                     size_t axis,
+                                                     const std::vector<int64_t>& lengths) {
+    auto axis_const = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {axis});
+    auto lengths_const = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{lengths.size()}, lengths);
+    return std::make_shared<SplitOptimized>(data, axis_const, lengths_const);
+}
+
+bool change_split_to_split_optimized(const std::shared_ptr<ov::Node>& split) {
+    const auto axis = get_axis(*split, 1);
+    if (!axis || !is_outer_axis(split->get_input_shape(0), *axis)) {
+        return false;
+    }
+    std::vector<int64_t> lengths;
+    for (const auto& output : split->outputs()) {
+        const auto length = output.get_shape()[*axis];
+        if (length == 0) {
+            return false;
+        }
+        lengths.push_back(static_cast<int64_t>(length));
+    }
+
+    auto split_optimized = make_split_optimized(split->input_value(0), *axis, lengths);
+    split_optimized->set_friendly_name(split->get_friendly_name());
+    ov::copy_runtime_info(split, split_optimized);
+    ov::replace_node(split, split_optimized);
+    return true;
+}
+
+bool change_slice_to_split_optimized(const std::shared_ptr<ov::Node>& slice, const AxisRange& range) {
+    const auto dim = static_cast<int64_t>(slice->get_input_shape(0)[range.axis]);
+    std::vector<int64_t> lengths;
+    if (range.begin > 0) {
+        lengths.push_back(range.begin);
+    }
+    const size_t view_idx = lengths.size();
+    lengths.push_back(range.end - range.begin);
+    if (range.end < dim) {
+        lengths.push_back(dim - range.end);
+    }
+
+    auto split_optimized = make_split_optimized(slice->input_value(0), range.axis, lengths);
+    ov::NodeVector new_ops{split_optimized};
+    ov::Output<ov::Node> view = split_optimized->output(view_idx);
+    const auto& output_shape = slice->get_output_shape(0);
+    if (view.get_shape() != output_shape) {
+        auto reshape_const =
+            std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{output_shape.size()}, output_shape);
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(view, reshape_const, false);
+        split_optimized->set_friendly_name(slice->get_friendly_name() + "/SplitOptimized");
+        new_ops.push_back(reshape);
+        view = reshape;
+    }
+    view.get_node()->set_friendly_name(slice->get_friendly_name());
+    ov::copy_runtime_info(slice, new_ops);
+    ov::replace_node(slice, ov::OutputVector{view});
+    return true;
+}
+
+bool change_to_split_optimized(Matcher& m) {
+    const auto node = m.get_match_root();
+    if (ov::is_type<SplitOptimized>(node) || ov::is_type<ov::op::v0::Constant>(node->get_input_node_ptr(0)) ||
+        node->get_input_partial_shape(0).is_dynamic() || ov::shape_size(node->get_input_shape(0)) == 0) {
+        return false;
+    }
+    for (const auto& output : node->outputs()) {
+        if (is_read_by_concat_optimized(output)) {
+            return false;
+        }
+    }
+
+    if (ov::is_type<ov::op::v1::Split>(node) || ov::is_type<ov::op::v1::VariadicSplit>(node)) {
+        return change_split_to_split_optimized(node);
+    }
+    std::optional<AxisRange> range;
+    if (const auto slice = ov::as_type_ptr<ov::op::v1::StridedSlice>(node)) {
+        range = get_strided_slice_range(*slice);
+    } else if (const auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(node)) {
+        range = get_gather_range(*gather);
+    }
+    return range && change_slice_to_split_optimized(node, *range);
+}
+}  // namespace
+
+SplitTransformation::SplitTransformation() {
+    MATCHER_SCOPE(SplitTransformation);
+    auto split = wrap_type<ov::op::v1::Split,
+                           ov::op::v1::VariadicSplit,
+                           ov::op::v1::StridedSlice,
+                           ov::op::v1::Gather,
+                           ov::op::v7::Gather,
+                           ov::op::v8::Gather>(has_static_shape());
+
+    matcher_pass_callback callback = [](Matcher& m) { return change_to_split_optimized(m); };
+
+    auto m = std::make_shared<Matcher>(split, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::nvidia_gpu::pass
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::nvidia_gpu::pass {
+
+/**
+ * Replaces Split, VariadicSplit and StridedSlice/Gather which take a contiguous range
+ * of the outer axis with SplitOptimized, which outputs share the memory of its input.
+ * Should run after ConcatTransformation.
+ */
+class SplitTransformation : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("SplitTransformation", "0");
+    SplitTransformation();
+};
+
+}  // namespace ov::nvidia_gpu::pass
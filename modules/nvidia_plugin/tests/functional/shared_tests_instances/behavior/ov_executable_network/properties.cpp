@@ -72,7 +72,10 @@ const std::vector<ov::AnyMap> default_properties = {{ov::num_streams(1)},
                                                     {ov::enable_profiling(false)},
                                                     {ov::device::id("0")},
                                                     {ov::nvidia_gpu::operation_benchmark(false)},
-                                                    {ov::nvidia_gpu::use_cuda_graph(true)}};
+                                                    {ov::nvidia_gpu::use_cuda_graph(true)},
+                                                    {ov::nvidia_gpu::memory_planner(ov::nvidia_gpu::MemoryPlanner::MEMORY_SOLVER)},
+                                                    {ov::nvidia_gpu::memory_pool_max_size(0)},
+                                                    {ov::nvidia_gpu::memory_pool_idle_timeout(0)}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests,
                          OVCompiledModelPropertiesDefaultSupportedTests,
@@ -98,6 +101,10 @@ const std::vector<ov::AnyMap> properties = {
     {ov::enable_profiling(false)},
     {ov::device::id("0")},
     {ov::device::id("NVIDIA.0")},
+    {ov::nvidia_gpu::memory_planner(ov::nvidia_gpu::MemoryPlanner::BEST_FIT)},
+    {ov::nvidia_gpu::memory_planner(ov::nvidia_gpu::MemoryPlanner::AUTO)},
+    {ov::nvidia_gpu::memory_pool_max_size(4)},
+    {ov::nvidia_gpu::memory_pool_idle_timeout(1000)},
 };
 
 const std::vector<ov::AnyMap> hetero_properties = {
@@ -24,4 +24,13 @@ TEST_F(CancellationTokenTest, Cancel_No_Throw_Callback) {
     CancellationToken token{[&is_cancelled] { is_cancelled = true; }};
     ASSERT_NO_THROW(token.cancel());
     ASSERT_TRUE(is_cancelled);
-}
\ No newline at end of file
+}
+
+TEST_F(CancellationTokenTest, Cancel_Reset) {
+    CancellationToken token{};
+    ASSERT_FALSE(token.is_cancelled());
+    token.cancel();
+    ASSERT_TRUE(token.is_cancelled());
+    token.reset();
+    ASSERT_FALSE(token.is_cancelled());
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_manager/model/details/cuda_memory_planners.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <sstream>
+
+using namespace ov::nvidia_gpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+
+constexpr MemoryPlanner kAllPlanners[] = {MemoryPlanner::MEMORY_SOLVER,
+                                          MemoryPlanner::GREEDY_BY_SIZE,
+                                          MemoryPlanner::GREEDY_BY_BREADTH,
+                                          MemoryPlanner::BEST_FIT,
+                                          MemoryPlanner::EXACT,
+                                          MemoryPlanner::AUTO};
+
+/**
+ * Random boxes with sizes multiple of 256, like the ones produced by MemoryModelBuilder.
+ */
+std::vector<Box> randomBoxes(size_t count, int steps, unsigned seed) {
+    std::mt19937 gen{seed};
+    std::uniform_int_distribution<int> start_dist{0, steps - 1};
+    std::uniform_int_distribution<int> length_dist{0, 4};
+    std::uniform_int_distribution<int64_t> size_dist{1, 16};
+    std::vector<Box> boxes;
+    for (size_t i = 0; i < count; ++i) {
+        const int start = start_dist(gen);
+        const int finish = (i % 7 == 0) ? -1 : std::min(steps - 1, start + length_dist(gen));
+        boxes.push_back({start, finish, size_dist(gen) * 256, static_cast<int64_t>(i)});
+    }
+    return boxes;
+}
+
+}  // namespace
+
+/*
+  The chain of 4 tensors from MemoryModelBuilder.Build test:
+
+    t0 | ========   .    .    .
+    t1 |  .   ========   .    .
+    t2 |  .    .   ========   .
+    t3 |  .    .    .   =======
+       |__.____.____.____.____.__ op indices
+          0    1    2    3    4
+
+  At most two tensors are alive at once, so every planner should fit them
+  into two slots.
+ */
+TEST(MemoryPlanners, Chain) {
+    const std::vector<Box> boxes{{0, 1, 256, 0}, {1, 2, 256, 1}, {2, 3, 256, 2}, {3, 4, 256, 3}};
+    for (auto planner : kAllPlanners) {
+        const auto plan = planMemory(planner, boxes);
+        ASSERT_TRUE(isValidMemoryPlan(plan, boxes)) << planner;
+        ASSERT_EQ(plan.size, 2 * 256) << planner;
+        ASSERT_EQ(plan.offsets.size(), boxes.size()) << planner;
+        ASSERT_NE(plan.offsets.at(0), plan.offsets.at(1)) << planner;
+        ASSERT_EQ(plan.offsets.at(0), plan.offsets.at(2)) << planner;
+        ASSERT_EQ(plan.offsets.at(1), plan.offsets.at(3)) << planner;
+    }
+}
+
+TEST(MemoryPlanners, Empty) {
+    for (auto planner : kAllPlanners) {
+        const auto plan = planMemory(planner, {});
+        ASSERT_EQ(plan.size, 0) << planner;
+        ASSERT_TRUE(plan.offsets.empty()) << planner;
+    }
+}
+
+TEST(MemoryPlanners, TillEnd) {
+    // Box 0 lives till the end, so box 2 can reuse only the memory of box 1
+    const std::vector<Box> boxes{{0, -1, 512, 0}, {0, 1, 256, 1}, {5, 6, 256, 2}};
+    for (auto planner : kAllPlanners) {
+        const auto plan = planMemory(planner, boxes);
+        ASSERT_TRUE(isValidMemoryPlan(plan, boxes)) << planner;
+        ASSERT_EQ(plan.size, 768) << planner;
+    }
+}
+
+TEST(MemoryPlanners, InvalidPlan) {
+    const std::vector<Box> boxes{{0, 2, 256, 0}, {1, 3, 256, 1}};
+    ASSERT_FALSE(isValidMemoryPlan({256, {{0, 0}, {1, 0}}}, boxes));
+    ASSERT_FALSE(isValidMemoryPlan({256, {{0, 0}, {1, 256}}}, boxes));
+    ASSERT_FALSE(isValidMemoryPlan({512, {{0, 0}}}, boxes));
+    ASSERT_TRUE(isValidMemoryPlan({512, {{0, 0}, {1, 256}}}, boxes));
+}
+
+TEST(MemoryPlanners, RandomBoxes) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        const auto boxes = randomBoxes(200, 50, seed);
+        const auto solver_plan = planMemory(MemoryPlanner::MEMORY_SOLVER, boxes);
+        for (auto planner : kAllPlanners) {
+            const auto plan = planMemory(planner, boxes);
+            ASSERT_TRUE(isValidMemoryPlan(plan, boxes)) << planner << ", seed " << seed;
+            if (planner == MemoryPlanner::AUTO) {
+                ASSERT_LE(plan.size, solver_plan.size) << "seed " << seed;
+            }
+        }
+    }
+}
+
+TEST(MemoryPlanners, ExactIsNotWorse) {
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        const auto boxes = randomBoxes(kExactPlannerMaxBoxes, 8, seed);
+        const auto exact_plan = planMemory(MemoryPlanner::EXACT, boxes);
+        ASSERT_TRUE(isValidMemoryPlan(exact_plan, boxes)) << "seed " << seed;
+        for (auto planner : kAllPlanners) {
+            ASSERT_LE(exact_plan.size, planMemory(planner, boxes).size) << planner << ", seed " << seed;
+        }
+    }
+}
+
+TEST(MemoryPlanners, PropertyStringConversion) {
+    for (auto planner : kAllPlanners) {
+        std::stringstream ss;
+        ss << planner;
+        MemoryPlanner parsed = MemoryPlanner::MEMORY_SOLVER;
+        ss >> parsed;
+        ASSERT_EQ(parsed, planner);
+    }
+    std::stringstream ss{"NOT_A_PLANNER"};
+    MemoryPlanner parsed;
+    ASSERT_THROW(ss >> parsed, ov::Exception);
+}
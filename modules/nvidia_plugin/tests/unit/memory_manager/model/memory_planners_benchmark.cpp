@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cuda_op_buffers_extractor.hpp"
+#include "memory_manager/model/details/cuda_memory_planners.hpp"
+#include "memory_manager/model/details/cuda_memory_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+using Box = ov::MemorySolver::Box;
+using ov::nvidia_gpu::MemoryPlanner;
+
+/**
+ * Colon separated paths to IR files. Synthetic models are used when it isn't set.
+ */
+constexpr const char* kModelsEnvVariable = "NVIDIA_MEMORY_PLANNER_BENCHMARK_MODELS";
+
+/**
+ * Creates a model of `depth` residual blocks. Each block also has a side branch of doubled width
+ * ending with a Result, so tensors of different sizes and lifespans are interleaved.
+ */
+std::shared_ptr<ov::Model> createSyntheticModel(size_t depth) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64, 56, 56});
+    ov::ResultVector results;
+    ov::Output<ov::Node> node = param;
+    for (size_t i = 0; i < depth; ++i) {
+        auto relu = std::make_shared<ov::op::v0::Relu>(node);
+        auto wide = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{relu, node}, 1);
+        results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v0::Relu>(wide)));
+        auto branch = std::make_shared<ov::op::v0::Relu>(relu);
+        node = std::make_shared<ov::op::v1::Add>(branch, node);
+    }
+    results.push_back(std::make_shared<ov::op::v0::Result>(node));
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{param});
+}
+
+/**
+ * Collects the boxes MemoryModelBuilder gets for mutable buffers of the model.
+ */
+std::vector<Box> extractBoxes(const ov::Model& model) {
+    const auto ordered_nodes = model.get_ordered_ops();
+    static constexpr bool isInPlaceEnabled = true;
+    const ov::nvidia_gpu::OperationBuffersExtractor extractor{ordered_nodes, false, false, isInPlaceEnabled};
+    std::vector<Box> boxes;
+    for (auto id : extractor.mutableBuffersIds()) {
+        boxes.push_back({extractor.mutableBufferLifespanStart(id),
+                         extractor.mutableBufferLifespanEnd(id),
+                         static_cast<int64_t>(ov::nvidia_gpu::applyAllignment(extractor.mutableBufferSize(id))),
+                         id});
+    }
+    return boxes;
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<ov::Model>>> loadModels() {
+    std::vector<std::pair<std::string, std::shared_ptr<ov::Model>>> models;
+    const char* paths = std::getenv(kModelsEnvVariable);
+    if (paths != nullptr && *paths != '\0') {
+        ov::Core core;
+        std::stringstream ss{paths};
+        std::string path;
+        while (std::getline(ss, path, ':')) {
+            if (!path.empty()) {
+                models.emplace_back(path, core.read_model(path));
+            }
+        }
+    } else {
+        for (size_t depth : {4, 32, 256}) {
+            models.emplace_back("synthetic_" + std::to_string(depth), createSyntheticModel(depth));
+        }
+    }
+    return models;
+}
+
+}  // namespace
+
+/**
+ * Replays boxes of OperationBuffersExtractor for every model and reports the blob size and planning time
+ * of each planner. Runs on CPU only, e.g.:
+ *   NVIDIA_MEMORY_PLANNER_BENCHMARK_MODELS=resnet50.xml:bert.xml \
+ *     ov_nvidia_unit_tests --gtest_also_run_disabled_tests --gtest_filter=MemoryPlannersBenchmark.*
+ */
+TEST(MemoryPlannersBenchmark, DISABLED_benchmark) {
+    using milliseconds = std::chrono::duration<double, std::milli>;
+    constexpr int kNumAttempts = 10;
+    constexpr MemoryPlanner planners[] = {MemoryPlanner::MEMORY_SOLVER,
+                                          MemoryPlanner::GREEDY_BY_SIZE,
+                                          MemoryPlanner::GREEDY_BY_BREADTH,
+                                          MemoryPlanner::BEST_FIT,
+                                          MemoryPlanner::EXACT,
+                                          MemoryPlanner::AUTO};
+
+    for (const auto& model : loadModels()) {
+        const auto boxes = extractBoxes(*model.second);
+        int64_t total_size = 0;
+        for (const auto& box : boxes) {
+            total_size += box.size;
+        }
+        std::cout << model.first << ": " << boxes.size() << " buffers, " << total_size << " bytes without reuse\n";
+        for (auto planner : planners) {
+            ov::nvidia_gpu::MemoryPlan plan;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < kNumAttempts; i++) {
+                plan = ov::nvidia_gpu::planMemory(planner, boxes);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            ASSERT_TRUE(ov::nvidia_gpu::isValidMemoryPlan(plan, boxes)) << planner;
+            const milliseconds planning_time = (end - start) / kNumAttempts;
+            std::cout << "    " << std::setw(17) << std::left << planner << std::right << " peak " << std::setw(12)
+                      << plan.size << " bytes, planning " << std::fixed << std::setprecision(3)
+                      << planning_time.count() << " ms\n";
+        }
+    }
+}
@@ -4,6 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "memory_manager/cuda_memory_pool.hpp"
 #include "memory_manager/model/cuda_memory_model.hpp"
 
@@ -16,6 +23,23 @@ class MemoryPoolTest : public testing::Test {
 
 public:
     size_t GetNumAvailableMemoryManagers(MemoryPool& memManPool) { return memManPool.memory_blocks_.size(); }
+
+    size_t GetNumWaiters(MemoryPool& memManPool) {
+        std::lock_guard<std::mutex> lock{memManPool.mtx_};
+        return memManPool.waiters_.size();
+    }
+
+    void WaitForWaiters(MemoryPool& memManPool, size_t num) {
+        while (GetNumWaiters(memManPool) < num) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::shared_ptr<MemoryPool> CreateMemoryPool(
+        size_t num, size_t maxSize = 0, std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero()) {
+        std::unordered_map<BufferID, ptrdiff_t> offsets;
+        return std::make_shared<MemoryPool>(num, std::make_shared<MemoryModel>(1000, offsets), maxSize, idleTimeout);
+    }
 };
 
 TEST_F(MemoryPoolTest, MemoryManagerProxy_Success) {
@@ -40,3 +64,143 @@ TEST_F(MemoryPoolTest, MemoryManagerProxy_Success) {
     }
     ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 2);
 }
+
+TEST_F(MemoryPoolTest, WaitAndGet_Cancelled) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(1);
+    auto memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+
+    CancellationToken waiterToken{};
+    auto waiter = std::async(std::launch::async, [&] { memoryPool->WaitAndGet(waiterToken); });
+    WaitForWaiters(*memoryPool, 1);
+    waiterToken.cancel();
+    memoryPool->Interrupt();
+    ASSERT_THROW(waiter.get(), ov::Exception);
+    ASSERT_EQ(GetNumWaiters(*memoryPool), 0);
+}
+
+TEST_F(MemoryPoolTest, WaitAndGet_InterruptDoesNotWakeUpNotCancelled) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(1);
+    std::optional<MemoryPool::Proxy> memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+
+    CancellationToken waiterToken{};
+    auto waiter = std::async(std::launch::async, [&] { memoryPool->WaitAndGet(waiterToken); });
+    WaitForWaiters(*memoryPool, 1);
+    memoryPool->Interrupt();
+    ASSERT_EQ(waiter.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    memoryManagerProxy.reset();
+    ASSERT_NO_THROW(waiter.get());
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 1);
+}
+
+TEST_F(MemoryPoolTest, WaitAndGet_FifoOrder) {
+    constexpr size_t kNumWaiters = 4;
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(1);
+    std::optional<MemoryPool::Proxy> memoryManagerProxy = memoryPool->WaitAndGet(cancellationToken);
+
+    std::mutex mtx;
+    std::vector<size_t> order;
+    std::vector<std::future<void>> waiters;
+    for (size_t i = 0; i < kNumWaiters; ++i) {
+        waiters.push_back(std::async(std::launch::async, [&, i] {
+            auto proxy = memoryPool->WaitAndGet(cancellationToken);
+            std::lock_guard<std::mutex> lock{mtx};
+            order.push_back(i);
+        }));
+        WaitForWaiters(*memoryPool, i + 1);
+    }
+    memoryManagerProxy.reset();
+    for (auto& waiter : waiters) {
+        waiter.get();
+    }
+    ASSERT_EQ(order, (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+TEST_F(MemoryPoolTest, WaitAndGet_Affinity) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(3);
+    const int owners[3] = {};
+    std::vector<DeviceMemBlock*> blocks;
+    {
+        std::vector<MemoryPool::Proxy> proxies;
+        for (const auto& owner : owners) {
+            proxies.push_back(memoryPool->WaitAndGet(cancellationToken, &owner));
+            blocks.push_back(&proxies.back().Get());
+        }
+    }
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        auto proxy_2 = memoryPool->WaitAndGet(cancellationToken, &owners[2]);
+        auto proxy_0 = memoryPool->WaitAndGet(cancellationToken, &owners[0]);
+        ASSERT_EQ(&proxy_2.Get(), blocks[2]);
+        ASSERT_EQ(&proxy_0.Get(), blocks[0]);
+    }
+    // A new owner gets the least recently returned block
+    const int newOwner = 0;
+    auto proxy = memoryPool->WaitAndGet(cancellationToken, &newOwner);
+    ASSERT_EQ(&proxy.Get(), blocks[1]);
+}
+
+TEST_F(MemoryPoolTest, WaitAndGet_GrowsUpToMaxSize) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(1, 3);
+    std::vector<MemoryPool::Proxy> proxies;
+    for (int i = 0; i < 3; ++i) {
+        proxies.push_back(memoryPool->WaitAndGet(cancellationToken));
+    }
+    ASSERT_EQ(memoryPool->Size(), 1);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 3);
+    ASSERT_EQ(memoryPool->GetStatistics().peak_size, 3);
+
+    auto waiter = std::async(std::launch::async, [&] { memoryPool->WaitAndGet(cancellationToken); });
+    WaitForWaiters(*memoryPool, 1);
+    ASSERT_EQ(memoryPool->GetStatistics().waiting, 1);
+    ASSERT_EQ(waiter.wait_for(std::chrono::milliseconds(50)), std::future_status::timeout);
+    proxies.pop_back();
+    ASSERT_NO_THROW(waiter.get());
+    ASSERT_EQ(memoryPool->GetStatistics().waiting, 0);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 3);
+    ASSERT_EQ(memoryPool->GetStatistics().requested_size, 1);
+    ASSERT_EQ(memoryPool->GetStatistics().allocated_size, 1);
+    ASSERT_EQ(memoryPool->GetStatistics().failed_allocations, 0);
+}
+
+TEST_F(MemoryPoolTest, IdleBlocksReleased) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(2, 4, std::chrono::milliseconds(10));
+    {
+        std::vector<MemoryPool::Proxy> proxies;
+        for (int i = 0; i < 4; ++i) {
+            proxies.push_back(memoryPool->WaitAndGet(cancellationToken));
+        }
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (memoryPool->GetStatistics().size > 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(memoryPool->GetStatistics().size, 1);
+    ASSERT_EQ(memoryPool->GetStatistics().peak_size, 4);
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 1);
+
+    // Released blocks are allocated again on demand
+    auto proxy0 = memoryPool->WaitAndGet(cancellationToken);
+    auto proxy1 = memoryPool->WaitAndGet(cancellationToken);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 2);
+}
+
+TEST_F(MemoryPoolTest, Resize) {
+    CancellationToken cancellationToken{};
+    auto memoryPool = CreateMemoryPool(3);
+    memoryPool->Resize(1);
+    ASSERT_EQ(memoryPool->Size(), 1);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 1);
+    ASSERT_EQ(GetNumAvailableMemoryManagers(*memoryPool), 1);
+
+    memoryPool->Resize(2);
+    ASSERT_EQ(memoryPool->Size(), 2);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 1);
+    auto proxy0 = memoryPool->WaitAndGet(cancellationToken);
+    auto proxy1 = memoryPool->WaitAndGet(cancellationToken);
+    ASSERT_EQ(memoryPool->GetStatistics().size, 2);
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "memory_manager/cuda_memory_pool.hpp"
+#include "memory_manager/model/cuda_memory_model.hpp"
+
+using namespace ov::nvidia_gpu;
+
+namespace {
+
+using microseconds = std::chrono::duration<double, std::micro>;
+
+/**
+ * Busy waits for the given time, as a short inference holding DeviceMemBlock
+ */
+void spinFor(microseconds duration) {
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+}  // namespace
+
+/**
+ * Many threads compete for a few DeviceMemBlock-s. Device memory is touched only on pool creation,
+ * so the numbers show the queueing latency of the pool itself, e.g.:
+ *   ov_nvidia_unit_tests --gtest_also_run_disabled_tests --gtest_filter=MemoryPoolBenchmark.*
+ */
+TEST(MemoryPoolBenchmark, DISABLED_benchmark) {
+    constexpr size_t kNumBlocks = 4;
+    constexpr int kNumIterations = 2000;
+    constexpr microseconds kHoldTime{20};
+
+    for (bool withAffinity : {false, true}) {
+        for (size_t numThreads : {4, 16, 64}) {
+            std::unordered_map<BufferID, ptrdiff_t> offsets;
+            auto memoryPool = std::make_shared<MemoryPool>(kNumBlocks, std::make_shared<MemoryModel>(256, offsets));
+            std::mutex mtx;
+            std::vector<double> waitTimes;
+            std::vector<int> sameBlockCounts(numThreads, 0);
+            std::vector<std::thread> threads;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < numThreads; ++t) {
+                threads.emplace_back([&, t] {
+                    CancellationToken token{};
+                    const void* owner = withAffinity ? &sameBlockCounts[t] : nullptr;
+                    const DeviceMemBlock* lastBlock = nullptr;
+                    std::vector<double> threadWaitTimes;
+                    threadWaitTimes.reserve(kNumIterations);
+                    for (int i = 0; i < kNumIterations; ++i) {
+                        const auto waitStart = std::chrono::steady_clock::now();
+                        auto proxy = memoryPool->WaitAndGet(token, owner);
+                        threadWaitTimes.push_back(
+                            microseconds{std::chrono::steady_clock::now() - waitStart}.count());
+                        sameBlockCounts[t] += (&proxy.Get() == lastBlock);
+                        lastBlock = &proxy.Get();
+                        spinFor(kHoldTime);
+                    }
+                    std::lock_guard<std::mutex> lock{mtx};
+                    waitTimes.insert(waitTimes.end(), threadWaitTimes.begin(), threadWaitTimes.end());
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            const microseconds total = std::chrono::steady_clock::now() - start;
+
+            std::sort(waitTimes.begin(), waitTimes.end());
+            auto percentile = [&waitTimes](double p) {
+                return waitTimes.at(static_cast<size_t>(p * (waitTimes.size() - 1)));
+            };
+            int sameBlockCount = 0;
+            for (auto count : sameBlockCounts) {
+                sameBlockCount += count;
+            }
+            std::cout << std::fixed << std::setprecision(1) << (withAffinity ? "affinity   " : "no affinity")
+                      << ", threads " << std::setw(2) << numThreads << ": wait p50 " << percentile(0.5)
+                      << " us, p99 " << percentile(0.99) << " us, max " << waitTimes.back() << " us, same block "
+                      << 100.0 * sameBlockCount / waitTimes.size() << "%, throughput "
+                      << waitTimes.size() / (total.count() / 1e6) << " blocks/s\n";
+            ASSERT_EQ(waitTimes.size(), numThreads * kNumIterations);
+        }
+    }
+}
@@ -9,15 +9,20 @@
 #include <vector>
 
 #include "cuda_op_buffers_extractor.hpp"
+#include "memory_manager/model/details/cuda_memory_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/softmax.hpp"
 #include "openvino/op/squeeze.hpp"
 #include "openvino/op/unsqueeze.hpp"
 #include "transformer/nodes/concat_optimized.hpp"
+#include "transformer/nodes/split_optimized.hpp"
 
 /*
  * TODO: To be moved to functional tests once they are enabled for nvidia_gpu
@@ -579,3 +584,273 @@ TEST_F(OperationBufferExtractorConcatOptimizedV2Test, CheckImmutableBuffersIndic
                             OutputBufferIndex::Constant_Adder_1,
                             OutputBufferIndex::Constant_Reshape_1_Pattern));
 }
+
+class OperationBufferExtractorInPlaceTest : public testing::Test {
+    /**
+     * Creates a graph with the following structure (left to right):
+     * ```
+     * Parameter --> Relu ---> Sigmoid --> Add --> Multiply --> Softmax --> Result
+     *                    \______________/        /
+     *                                     Constant
+     * ```
+     * Relu may reuse the Parameter buffer, Sigmoid may not as its input is used by Add afterwards.
+     * Add reuses the Sigmoid buffer as the first declared candidate, Multiply reuses it as well
+     * through its second input, Softmax doesn't declare in-place outputs.
+     */
+    void SetUp() override {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({2, 8}));
+        relu_ = std::make_shared<ov::op::v0::Relu>(input);
+        sigmoid_ = std::make_shared<ov::op::v0::Sigmoid>(relu_);
+        add_ = std::make_shared<ov::op::v1::Add>(sigmoid_, relu_);
+        auto scale = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{8}, std::vector<float>(8, 0.5f));
+        multiply_ = std::make_shared<ov::op::v1::Multiply>(scale, add_);
+        softmax_ = std::make_shared<ov::op::v1::Softmax>(multiply_, 1);
+        result_ = std::make_shared<ov::op::v0::Result>(softmax_);
+        parameter_ = input;
+
+        model_ = std::make_unique<ov::Model>(ov::ResultVector{result_}, ov::ParameterVector{input}, "InPlaceGraph");
+        exec_sequence_ = model_->get_ordered_ops();
+        static constexpr bool isInPlaceEnabled = true;
+        extractor_ = std::make_unique<ov::nvidia_gpu::OperationBuffersExtractor>(
+            exec_sequence_, false, false, isInPlaceEnabled);
+    }
+
+protected:
+    using TensorID = ov::nvidia_gpu::TensorID;
+
+    int indexOf(const std::shared_ptr<ov::Node>& node) const {
+        const auto found = std::find(exec_sequence_.begin(), exec_sequence_.end(), node);
+        EXPECT_NE(found, exec_sequence_.end());
+        return static_cast<int>(found - exec_sequence_.begin());
+    }
+
+    TensorID output(const std::shared_ptr<ov::Node>& node) const {
+        return extractor_->outputTensorIds(*node).at(0);
+    }
+
+    ov::nvidia_gpu::BufferID bufferOf(const std::shared_ptr<ov::Node>& node) const {
+        return output(node).GetBuffer().GetId();
+    }
+
+    std::shared_ptr<ov::Node> parameter_;
+    std::shared_ptr<ov::Node> relu_;
+    std::shared_ptr<ov::Node> sigmoid_;
+    std::shared_ptr<ov::Node> add_;
+    std::shared_ptr<ov::Node> multiply_;
+    std::shared_ptr<ov::Node> softmax_;
+    std::shared_ptr<ov::Node> result_;
+    std::unique_ptr<ov::Model> model_;
+    std::vector<std::shared_ptr<ov::Node>> exec_sequence_;
+    std::unique_ptr<ov::nvidia_gpu::OperationBuffersExtractor> extractor_;
+};
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckSharedBuffers) {
+    EXPECT_EQ(bufferOf(relu_), bufferOf(parameter_));
+    EXPECT_NE(bufferOf(sigmoid_), bufferOf(parameter_));
+    EXPECT_EQ(bufferOf(add_), bufferOf(sigmoid_));
+    EXPECT_EQ(bufferOf(multiply_), bufferOf(sigmoid_));
+    EXPECT_NE(bufferOf(softmax_), bufferOf(sigmoid_));
+    EXPECT_NE(bufferOf(softmax_), bufferOf(parameter_));
+    for (const auto& node : {relu_, add_, multiply_}) {
+        EXPECT_EQ(output(node).GetOffset(), 0);
+    }
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckTensorIdsAreKept) {
+    EXPECT_NE(output(relu_), output(parameter_));
+    EXPECT_NE(output(add_), output(sigmoid_));
+    EXPECT_EQ(extractor_->inputTensorIds(*sigmoid_).at(0), output(relu_));
+    EXPECT_EQ(extractor_->inputTensorIds(*softmax_).at(0), output(multiply_));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckMutableBuffersIndices) {
+    using ::testing::UnorderedElementsAre;
+    ASSERT_THAT(extractor_->mutableBuffersIds(),
+                UnorderedElementsAre(bufferOf(parameter_), bufferOf(sigmoid_), bufferOf(softmax_)));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckMutableBuffersLifespans) {
+    ASSERT_EQ(extractor_->mutableBufferLifespanStart(bufferOf(parameter_)), indexOf(parameter_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(bufferOf(parameter_)), indexOf(add_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanStart(bufferOf(sigmoid_)), indexOf(sigmoid_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(bufferOf(sigmoid_)), indexOf(softmax_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanStart(bufferOf(softmax_)), indexOf(softmax_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(bufferOf(softmax_)), indexOf(result_));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckMutableBuffersOffsets) {
+    const auto model = extractor_->createMutableMemoryModel();
+    auto offsetOf = [&model](const TensorID& tensor) {
+        ptrdiff_t offset = -1;
+        EXPECT_TRUE(model->offsetForBuffer(tensor.GetBuffer().GetId(), offset));
+        return offset + tensor.GetOffset();
+    };
+    EXPECT_EQ(offsetOf(output(relu_)), offsetOf(output(parameter_)));
+    EXPECT_EQ(offsetOf(output(add_)), offsetOf(output(sigmoid_)));
+    EXPECT_EQ(offsetOf(output(multiply_)), offsetOf(output(sigmoid_)));
+    EXPECT_NE(offsetOf(output(sigmoid_)), offsetOf(output(parameter_)));
+    EXPECT_NE(offsetOf(output(softmax_)), offsetOf(output(sigmoid_)));
+    // Three tensors of 64 bytes, at most two of them are alive at once
+    EXPECT_EQ(model->deviceMemoryBlockSize(), 2 * ov::nvidia_gpu::applyAllignment(64));
+}
+
+TEST_F(OperationBufferExtractorInPlaceTest, CheckDisabledInPlace) {
+    const ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence_};
+    auto bufferOf = [&extractor](const std::shared_ptr<ov::Node>& node) {
+        return extractor.outputTensorIds(*node).at(0).GetBuffer().GetId();
+    };
+    EXPECT_NE(bufferOf(relu_), bufferOf(parameter_));
+    EXPECT_NE(bufferOf(add_), bufferOf(sigmoid_));
+    EXPECT_NE(bufferOf(multiply_), bufferOf(add_));
+    EXPECT_EQ(extractor.mutableBuffersIds().size(), 6);
+}
+
+TEST(OperationBufferExtractorInPlace, BroadcastedInputIsNotReused) {
+    /**
+     * ```
+     * Parameter [2, 8] --> Relu --\
+     *                               Add --> Result
+     * Parameter [8] -----> Relu --/
+     * ```
+     * Add can't write to the memory of its broadcasted first input, so it reuses the second one.
+     */
+    auto input_0 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({2, 8}));
+    auto input_1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({8}));
+    auto relu_0 = std::make_shared<ov::op::v0::Relu>(input_0);
+    auto relu_1 = std::make_shared<ov::op::v0::Relu>(input_1);
+    auto add = std::make_shared<ov::op::v1::Add>(relu_1, relu_0);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{input_0, input_1}, "BroadcastGraph"};
+
+    const auto exec_sequence = model.get_ordered_ops();
+    static constexpr bool isInPlaceEnabled = true;
+    const ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence, false, false, isInPlaceEnabled};
+    auto bufferOf = [&extractor](const std::shared_ptr<ov::Node>& node) {
+        return extractor.outputTensorIds(*node).at(0).GetBuffer().GetId();
+    };
+    EXPECT_EQ(bufferOf(relu_0), bufferOf(input_0));
+    EXPECT_EQ(bufferOf(relu_1), bufferOf(input_1));
+    EXPECT_EQ(bufferOf(add), bufferOf(input_0));
+    EXPECT_EQ(extractor.mutableBuffersIds().size(), 2);
+}
+
+TEST(OperationBufferExtractorInPlace, StableParametersAreNotReused) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({2, 8}));
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{input}, "StableParametersGraph"};
+
+    const auto exec_sequence = model.get_ordered_ops();
+    static constexpr bool isStableParams = true;
+    static constexpr bool isInPlaceEnabled = true;
+    const ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence, isStableParams, false, isInPlaceEnabled};
+    EXPECT_NE(extractor.outputTensorIds(*relu).at(0).GetBuffer().GetId(),
+              extractor.outputTensorIds(*input).at(0).GetBuffer().GetId());
+}
+
+class OperationBufferExtractorSplitOptimizedTest : public testing::Test {
+    /**
+     * Creates a graph with the following structure (left to right):
+     * ```
+     * Parameter --> Relu --> SplitOptimized --> Sigmoid --> Result
+     *                                       \
+     *                                         --> Relu --> Result
+     * ```
+     * Outputs of SplitOptimized are parts of the Relu buffer, which lives till the last of their readers.
+     * Sigmoid can't be placed in-place, its input is only a part of the buffer.
+     */
+    void SetUp() override {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({3, 2, 4}));
+        relu_ = std::make_shared<ov::op::v0::Relu>(input);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+        auto lengths = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+        split_ = std::make_shared<ov::nvidia_gpu::nodes::SplitOptimized>(relu_, axis, lengths);
+        sigmoid_ = std::make_shared<ov::op::v0::Sigmoid>(split_->output(0));
+        relu_1_ = std::make_shared<ov::op::v0::Relu>(split_->output(1));
+        auto result_0 = std::make_shared<ov::op::v0::Result>(sigmoid_);
+        auto result_1 = std::make_shared<ov::op::v0::Result>(relu_1_);
+        parameter_ = input;
+
+        model_ = std::make_unique<ov::Model>(
+            ov::ResultVector{result_0, result_1}, ov::ParameterVector{input}, "SplitOptimizedGraph");
+        exec_sequence_ = model_->get_ordered_ops();
+        static constexpr bool isInPlaceEnabled = true;
+        extractor_ = std::make_unique<ov::nvidia_gpu::OperationBuffersExtractor>(
+            exec_sequence_, false, false, isInPlaceEnabled);
+    }
+
+protected:
+    using TensorID = ov::nvidia_gpu::TensorID;
+
+    int indexOf(const std::shared_ptr<ov::Node>& node) const {
+        const auto found = std::find(exec_sequence_.begin(), exec_sequence_.end(), node);
+        EXPECT_NE(found, exec_sequence_.end());
+        return static_cast<int>(found - exec_sequence_.begin());
+    }
+
+    TensorID output(const std::shared_ptr<ov::Node>& node, size_t idx = 0) const {
+        return extractor_->outputTensorIds(*node).at(idx);
+    }
+
+    ov::nvidia_gpu::BufferID bufferOf(const std::shared_ptr<ov::Node>& node) const {
+        return output(node).GetBuffer().GetId();
+    }
+
+    std::shared_ptr<ov::Node> parameter_;
+    std::shared_ptr<ov::Node> relu_;
+    std::shared_ptr<ov::Node> split_;
+    std::shared_ptr<ov::Node> sigmoid_;
+    std::shared_ptr<ov::Node> relu_1_;
+    std::unique_ptr<ov::Model> model_;
+    std::vector<std::shared_ptr<ov::Node>> exec_sequence_;
+    std::unique_ptr<ov::nvidia_gpu::OperationBuffersExtractor> extractor_;
+};
+
+TEST_F(OperationBufferExtractorSplitOptimizedTest, CheckTensorIdsAndOffsets) {
+    const auto chunk_0 = output(split_, 0);
+    const auto chunk_1 = output(split_, 1);
+    EXPECT_NE(chunk_0, output(relu_));
+    EXPECT_NE(chunk_1, output(relu_));
+    EXPECT_NE(chunk_0, chunk_1);
+    EXPECT_EQ(chunk_0.GetBuffer().GetId(), bufferOf(relu_));
+    EXPECT_EQ(chunk_1.GetBuffer().GetId(), bufferOf(relu_));
+    EXPECT_EQ(chunk_0.GetOffset(), output(relu_).GetOffset());
+    EXPECT_EQ(chunk_1.GetOffset(), output(relu_).GetOffset() + 1 * 2 * 4 * sizeof(float));
+    EXPECT_EQ(extractor_->inputTensorIds(*sigmoid_).at(0), chunk_0);
+    EXPECT_EQ(extractor_->inputTensorIds(*relu_1_).at(0), chunk_1);
+    EXPECT_EQ(extractor_->inputTensorIds(*relu_1_).at(0).GetOffset(), chunk_1.GetOffset());
+}
+
+TEST_F(OperationBufferExtractorSplitOptimizedTest, CheckMutableBuffersIndices) {
+    using ::testing::UnorderedElementsAre;
+    ASSERT_THAT(extractor_->mutableBuffersIds(),
+                UnorderedElementsAre(bufferOf(relu_), bufferOf(sigmoid_), bufferOf(relu_1_)));
+}
+
+TEST_F(OperationBufferExtractorSplitOptimizedTest, CheckMutableBuffersLifespans) {
+    EXPECT_EQ(bufferOf(relu_), bufferOf(parameter_));
+    EXPECT_NE(bufferOf(sigmoid_), bufferOf(relu_));
+    EXPECT_NE(bufferOf(relu_1_), bufferOf(relu_));
+    ASSERT_EQ(extractor_->mutableBufferLifespanEnd(bufferOf(relu_)),
+              std::max(indexOf(sigmoid_), indexOf(relu_1_)));
+    ASSERT_EQ(extractor_->mutableBufferSize(bufferOf(relu_)), 3 * 2 * 4 * sizeof(float));
+}
+
+TEST(OperationBufferExtractorSplitOptimized, StableResultOfChunk) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape({2, 8}));
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+    auto lengths = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 1});
+    auto split = std::make_shared<ov::nvidia_gpu::nodes::SplitOptimized>(relu, axis, lengths);
+    auto result = std::make_shared<ov::op::v0::Result>(split->output(1));
+    ov::Model model{ov::ResultVector{result}, ov::ParameterVector{input}, "StableResultGraph"};
+
+    const auto exec_sequence = model.get_ordered_ops();
+    static constexpr bool isStableResults = true;
+    const ov::nvidia_gpu::OperationBuffersExtractor extractor{exec_sequence, false, isStableResults};
+    const auto chunk = extractor.outputTensorIds(*split).at(1);
+    const auto bufferId = extractor.outputTensorIds(*relu).at(0).GetBuffer().GetId();
+    EXPECT_EQ(chunk.GetBuffer().GetId(), bufferId);
+    EXPECT_EQ(chunk.GetOffset(), 8 * sizeof(float));
+    EXPECT_EQ(extractor.mutableBufferLifespanEnd(bufferId), static_cast<int>(exec_sequence.size()));
+}
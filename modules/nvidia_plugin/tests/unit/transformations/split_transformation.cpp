@@ -0,0 +1,207 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformer/split_transformation.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/split.hpp"
+#include "openvino/op/strided_slice.hpp"
+#include "openvino/op/variadic_split.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/init_node_info.hpp"
+#include "transformations/utils/utils.hpp"
+#include "transformer/nodes/concat_optimized.hpp"
+#include "transformer/nodes/split_optimized.hpp"
+
+using ov::nvidia_gpu::nodes::ConcatOptimized;
+using ov::nvidia_gpu::nodes::SplitOptimized;
+using namespace ov;
+using namespace std;
+
+namespace testing {
+
+namespace {
+void run_split_transformation(const shared_ptr<ov::Model>& model) {
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::InitNodeInfo>();
+    pass_manager.register_pass<nvidia_gpu::pass::SplitTransformation>();
+    pass_manager.run_passes(model);
+}
+
+shared_ptr<SplitOptimized> make_split_optimized(const Output<Node>& data, int64_t axis, vector<int64_t> lengths) {
+    auto axis_const = op::v0::Constant::create(element::i64, Shape{}, {axis});
+    auto lengths_const = op::v0::Constant::create(element::i64, Shape{lengths.size()}, lengths);
+    return make_shared<SplitOptimized>(data, axis_const, lengths_const);
+}
+}  // namespace
+
+TEST(split_optimized, split_3_outputs_axis_1) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 512});
+        auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
+        auto split = make_shared<op::v1::Split>(input, axis, 3);
+        model = make_shared<Model>(split->outputs(), ParameterVector{input});
+        run_split_transformation(model);
+    }
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 512});
+        auto split = make_split_optimized(input, 1, {2, 2, 2});
+        model_ref = make_shared<Model>(split->outputs(), ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(split_optimized, variadic_split_axis_negative) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 10, 64});
+        auto axis = op::v0::Constant::create(element::i64, Shape{}, {-2});
+        auto lengths = op::v0::Constant::create(element::i64, Shape{3}, {2, -1, 5});
+        auto split = make_shared<op::v1::VariadicSplit>(input, axis, lengths);
+        model = make_shared<Model>(split->outputs(), ParameterVector{input});
+        run_split_transformation(model);
+    }
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 10, 64});
+        auto split = make_split_optimized(input, 2, {2, 3, 5});
+        model_ref = make_shared<Model>(split->outputs(), ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(split_optimized, strided_slice_shrink_axis_0) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2, 4, 8});
+        auto begin = op::v0::Constant::create(element::i64, Shape{1}, {1});
+        auto end = op::v0::Constant::create(element::i64, Shape{1}, {2});
+        auto stride = op::v0::Constant::create(element::i64, Shape{1}, {1});
+        auto slice = make_shared<op::v1::StridedSlice>(
+            input, begin, end, stride, vector<int64_t>{0}, vector<int64_t>{0}, vector<int64_t>{}, vector<int64_t>{1});
+        model = make_shared<Model>(slice, ParameterVector{input});
+        run_split_transformation(model);
+    }
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2, 4, 8});
+        auto split = make_split_optimized(input, 0, {1, 1, 1});
+        auto shape = op::v0::Constant::create(element::i64, Shape{3}, {2, 4, 8});
+        auto reshape = make_shared<op::v1::Reshape>(split->output(1), shape, false);
+        model_ref = make_shared<Model>(reshape, ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(split_optimized, strided_slice_range_axis_1) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 12, 64});
+        auto begin = op::v0::Constant::create(element::i64, Shape{2}, {0, 0});
+        auto end = op::v0::Constant::create(element::i64, Shape{2}, {0, 4});
+        auto stride = op::v0::Constant::create(element::i64, Shape{2}, {1, 1});
+        auto slice = make_shared<op::v1::StridedSlice>(
+            input, begin, end, stride, vector<int64_t>{1, 0}, vector<int64_t>{1, 0});
+        model = make_shared<Model>(slice, ParameterVector{input});
+        run_split_transformation(model);
+    }
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 12, 64});
+        auto split = make_split_optimized(input, 1, {4, 8});
+        model_ref = make_shared<Model>(split->output(0), ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(split_optimized, gather_scalar_index_axis_0) {
+    shared_ptr<ov::Model> model, model_ref;
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2, 64});
+        auto indices = op::v0::Constant::create(element::i64, Shape{}, {-1});
+        auto axis = op::v0::Constant::create(element::i64, Shape{}, {0});
+        auto gather = make_shared<op::v8::Gather>(input, indices, axis);
+        model = make_shared<Model>(gather, ParameterVector{input});
+        run_split_transformation(model);
+    }
+    {
+        auto input = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2, 64});
+        auto split = make_split_optimized(input, 0, {2, 1});
+        auto shape = op::v0::Constant::create(element::i64, Shape{2}, {2, 64});
+        auto reshape = make_shared<op::v1::Reshape>(split->output(1), shape, false);
+        model_ref = make_shared<Model>(reshape, ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(split_optimized, split_inner_axis_fail) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{2, 6, 512});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
+    auto split = make_shared<op::v1::Split>(input, axis, 3);
+    auto model = make_shared<Model>(split->outputs(), ParameterVector{input});
+    run_split_transformation(model);
+
+    ASSERT_EQ(count_ops_of_type<SplitOptimized>(model), 0);
+}
+
+TEST(split_optimized, strided_slice_with_stride_fail) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{6, 64});
+    auto begin = op::v0::Constant::create(element::i64, Shape{1}, {0});
+    auto end = op::v0::Constant::create(element::i64, Shape{1}, {6});
+    auto stride = op::v0::Constant::create(element::i64, Shape{1}, {2});
+    auto slice = make_shared<op::v1::StridedSlice>(
+        input, begin, end, stride, vector<int64_t>{0}, vector<int64_t>{0});
+    auto model = make_shared<Model>(slice, ParameterVector{input});
+    run_split_transformation(model);
+
+    ASSERT_EQ(count_ops_of_type<SplitOptimized>(model), 0);
+}
+
+TEST(split_optimized, gather_not_consecutive_indices_fail) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 64});
+    auto indices = op::v0::Constant::create(element::i64, Shape{2}, {0, 2});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto gather = make_shared<op::v8::Gather>(input, indices, axis);
+    auto model = make_shared<Model>(gather, ParameterVector{input});
+    run_split_transformation(model);
+
+    ASSERT_EQ(count_ops_of_type<SplitOptimized>(model), 0);
+}
+
+TEST(split_optimized, split_to_concat_optimized_fail) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 512});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
+    auto split = make_shared<op::v1::Split>(input, axis, 2);
+    auto concat = make_shared<ConcatOptimized>(OutputVector{split->output(1), split->output(0)}, 1);
+    auto model = make_shared<Model>(concat, ParameterVector{input});
+    run_split_transformation(model);
+
+    ASSERT_EQ(count_ops_of_type<SplitOptimized>(model), 0);
+}
+
+TEST(split_optimized, split_dynamic_fail) {
+    auto input = make_shared<op::v0::Parameter>(element::f32, PartialShape{1, 6, -1});
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {1});
+    auto split = make_shared<op::v1::Split>(input, axis, 3);
+    auto model = make_shared<Model>(split->outputs(), ParameterVector{input});
+    run_split_transformation(model);
+
+    ASSERT_EQ(count_ops_of_type<SplitOptimized>(model), 0);
+}
+
+}  // namespace testing